@@ -28,6 +28,7 @@
 #include "storm/environment/Environment.h"
 
 #include "storm/exceptions/OptionParserException.h"
+#include "storm/exceptions/DdMemoryBudgetExceededException.h"
 
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
@@ -453,6 +454,18 @@ namespace storm {
                 options.setAddOverlappingGuardsLabel(true);
             }
 
+            if (buildSettings.isPartialOrderReductionSet()) {
+                options.setPartialOrderReduction(true);
+            }
+
+            if (buildSettings.isSymmetryReductionSet()) {
+                options.setSymmetryReduction(true);
+            }
+
+            if (buildSettings.isRewardThreadsSet()) {
+                options.setDeferStateRewards(true);
+            }
+
             return storm::api::buildSparseModel<ValueType>(input.model.get(), options, useJit, storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isDoctorSet());
         }
         
@@ -561,6 +574,12 @@ namespace storm {
                 result.second = true;
             }
             
+            if (transformationSettings.isPermuteStatesSet()) {
+                STORM_LOG_INFO("Renumbering the states in " << storm::utility::permutation::orderKindToString(transformationSettings.getPermutationOrder()) << " order...");
+                result.first = storm::api::permuteModelStates<ValueType>(result.first, transformationSettings.getPermutationOrder());
+                result.second = true;
+            }
+            
             return result;
         }
         
@@ -1149,13 +1168,26 @@ namespace storm {
             } else if (mpi.engine == storm::utility::Engine::Exploration) {
                 verifyWithExplorationEngine<VerificationValueType>(input, mpi);
             } else {
-                std::shared_ptr<storm::models::ModelBase> model = buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
-                if (model) {
-                    if (counterexampleSettings.isCounterexampleSet()) {
-                        generateCounterexamples<VerificationValueType>(model, input);
-                    } else {
-                        verifyModel<DdType, VerificationValueType>(model, input, mpi);
+                try {
+                    std::shared_ptr<storm::models::ModelBase> model = buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
+                    if (model) {
+                        if (counterexampleSettings.isCounterexampleSet()) {
+                            generateCounterexamples<VerificationValueType>(model, input);
+                        } else {
+                            verifyModel<DdType, VerificationValueType>(model, input, mpi);
+                        }
+                    }
+                } catch (storm::exceptions::DdMemoryBudgetExceededException const& e) {
+                    // If requested, retry with an engine that relies less on decision diagrams.
+                    bool engineFallback = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEngineFallbackSet();
+                    storm::utility::Engine fallbackEngine = storm::utility::getDdMemoryFallbackEngine(mpi.engine);
+                    if (!engineFallback || fallbackEngine == storm::utility::Engine::Unknown) {
+                        throw;
                     }
+                    ModelProcessingInformation fallbackMpi = mpi;
+                    fallbackMpi.engine = fallbackEngine;
+                    STORM_PRINT_AND_LOG("The " << mpi.engine << " engine exceeded the memory budget of the DD library (" << e.what() << "). Falling back to the " << fallbackMpi.engine << " engine." << std::endl);
+                    processInputWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, fallbackMpi);
                 }
             }
         }
@@ -20,6 +20,8 @@
 
 #ifdef STORM_HAVE_INTELTBB
 #include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
+#include "tbb/enumerable_thread_specific.h"
 #include "tbb/blocked_range.h"
 #include "tbb/tbb_stddef.h"
 #endif
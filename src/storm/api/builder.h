@@ -100,9 +100,9 @@ namespace storm {
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options, bool jit = false, bool doctor = false) {
             if (jit) {
-                STORM_LOG_THROW(model.isJaniModel(), storm::exceptions::NotSupportedException, "Cannot use JIT-based model builder for non-JANI model.");
-
-                storm::builder::jit::ExplicitJitJaniModelBuilder<ValueType> builder(model.asJaniModel(), options);
+                // PRISM programs are translated to JANI, so the JIT-based builder can be used for them as well.
+                STORM_LOG_THROW(model.isJaniModel() || model.isPrismProgram(), storm::exceptions::NotSupportedException, "Cannot use JIT-based model builder for this model description.");
+                storm::builder::jit::ExplicitJitJaniModelBuilder<ValueType> builder(model.isJaniModel() ? model.asJaniModel() : model.toJani(true).asJaniModel(), options);
 
                 if (doctor) {
                     bool result = builder.doctor();
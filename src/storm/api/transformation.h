@@ -3,9 +3,11 @@
 #include "storm/transformer/ContinuousToDiscreteTimeModelTransformer.h"
 #include "storm/transformer/SymbolicToSparseTransformer.h"
 #include "storm/transformer/NonMarkovianChainTransformer.h"
+#include "storm/transformer/StatePermuter.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/builder.h"
+#include "storm/utility/permutation.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -130,5 +132,13 @@ namespace storm {
             }
         }
 
+        /*!
+         * Renumbers the states of the given model in the given order.
+         */
+        template <typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> permuteModelStates(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::utility::permutation::OrderKind const& order) {
+            std::vector<uint64_t> stateOrder = storm::utility::permutation::createStateOrder(order, model->getTransitionMatrix(), model->getInitialStates());
+            return storm::transformer::StatePermuter<ValueType>::permuteStates(*model, stateOrder);
+        }
     }
 }
@@ -1,5 +1,7 @@
 #include "storm/builder/BuilderOptions.h"
 
+#include <algorithm>
+
 #include "storm/builder/TerminalStatesGetter.h"
 
 #include "storm/logic/Formulas.h"
@@ -39,7 +41,7 @@ namespace storm {
         }
         
 
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), partialOrderReduction(false), symmetryReduction(false), deferStateRewards(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
             // Intentionally left empty.
         }
         
@@ -55,6 +57,23 @@ namespace storm {
                 if (formulas.size() == 1) {
                     this->setTerminalStatesFromFormula(*formulas.front());
                 }
+                
+                // If the model evolves in discrete steps and all formulas only depend on a bounded number of steps,
+                // the states beyond the largest of these numbers need not be explored.
+                if (modelDescription.hasModel() && (modelDescription.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC || modelDescription.getModelType() == storm::storage::SymbolicModelDescription::ModelType::MDP || modelDescription.getModelType() == storm::storage::SymbolicModelDescription::ModelType::POMDP)) {
+                    boost::optional<uint64_t> depth = 0;
+                    for (auto const& formula : formulas) {
+                        boost::optional<uint64_t> formulaDepth = getExplorationDepthFromFormula(*formula);
+                        if (!formulaDepth) {
+                            depth = boost::none;
+                            break;
+                        }
+                        depth = std::max(depth.get(), formulaDepth.get());
+                    }
+                    if (depth) {
+                        this->setMaximalExplorationDepth(depth.get());
+                    }
+                }
             }
             
             auto const& generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
@@ -69,7 +88,7 @@ namespace storm {
         
         void BuilderOptions::preserveFormula(storm::logic::Formula const& formula, storm::storage::SymbolicModelDescription const& modelDescription) {
             // If we already had terminal states, we need to erase them.
-            if (hasTerminalStates()) {
+            if (hasTerminalStates() || hasMaximalExplorationDepth()) {
                 clearTerminalStates();
             }
             
@@ -121,6 +140,16 @@ namespace storm {
         
         void BuilderOptions::clearTerminalStates() {
             terminalStates.clear();
+            maximalExplorationDepth = boost::none;
+        }
+        
+        uint64_t BuilderOptions::getMaximalExplorationDepth() const {
+            STORM_LOG_ASSERT(maximalExplorationDepth, "Maximal exploration depth was not set.");
+            return maximalExplorationDepth.get();
+        }
+        
+        bool BuilderOptions::hasMaximalExplorationDepth() const {
+            return static_cast<bool>(maximalExplorationDepth);
         }
         
         bool BuilderOptions::isApplyMaximalProgressAssumptionSet() const {
@@ -167,6 +196,18 @@ namespace storm {
             return addOverlappingGuardsLabel;
         }
 
+        bool BuilderOptions::isPartialOrderReductionSet() const {
+            return partialOrderReduction;
+        }
+
+        bool BuilderOptions::isSymmetryReductionSet() const {
+            return symmetryReduction;
+        }
+
+        bool BuilderOptions::isDeferStateRewardsSet() const {
+            return deferStateRewards;
+        }
+
         BuilderOptions& BuilderOptions::setBuildAllRewardModels(bool newValue) {
             buildAllRewardModels = newValue;
             return *this;
@@ -263,6 +304,26 @@ namespace storm {
             return *this;
         }
 
+        BuilderOptions& BuilderOptions::setPartialOrderReduction(bool newValue) {
+            partialOrderReduction = newValue;
+            return *this;
+        }
+
+        BuilderOptions& BuilderOptions::setSymmetryReduction(bool newValue) {
+            symmetryReduction = newValue;
+            return *this;
+        }
+
+        BuilderOptions& BuilderOptions::setDeferStateRewards(bool newValue) {
+            deferStateRewards = newValue;
+            return *this;
+        }
+        
+        BuilderOptions& BuilderOptions::setMaximalExplorationDepth(uint64_t depth) {
+            maximalExplorationDepth = depth;
+            return *this;
+        }
+
         BuilderOptions& BuilderOptions::substituteExpressions(std::function<storm::expressions::Expression(storm::expressions::Expression const&)> const& substitutionFunction) {
             for (auto& e : expressionLabels) {
                 e.second = substitutionFunction(e.second);
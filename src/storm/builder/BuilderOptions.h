@@ -102,7 +102,18 @@ namespace storm {
             std::vector<std::pair<std::string, storm::expressions::Expression>> const& getExpressionLabels() const;
             std::vector<std::pair<LabelOrExpression, bool>> const& getTerminalStates() const;
             bool hasTerminalStates() const;
+            
+            /*!
+             * Clears the terminal states as well as the maximal exploration depth.
+             */
             void clearTerminalStates();
+            
+            /*!
+             * Retrieves the maximal distance (in steps) from the initial states up to which states are expanded.
+             * States at this distance are treated like terminal states.
+             */
+            uint64_t getMaximalExplorationDepth() const;
+            bool hasMaximalExplorationDepth() const;
             bool isApplyMaximalProgressAssumptionSet() const;
             bool isBuildChoiceLabelsSet() const;
             bool isBuildStateValuationsSet() const;
@@ -116,6 +127,9 @@ namespace storm {
             bool isAddOutOfBoundsStateSet() const;
             uint64_t getReservedBitsForUnboundedVariables() const;
             bool isAddOverlappingGuardLabelSet() const;
+            bool isPartialOrderReductionSet() const;
+            bool isSymmetryReductionSet() const;
+            bool isDeferStateRewardsSet() const;
             uint64_t getShowProgressDelay() const;
 
             /**
@@ -197,6 +211,31 @@ namespace storm {
              */
             BuilderOptions& setAddOverlappingGuardsLabel(bool newValue = true);
 
+            /**
+             * Should partial-order reduction be applied when exploring MDPs?
+             * @param newValue the new value (default true)
+             */
+            BuilderOptions& setPartialOrderReduction(bool newValue = true);
+
+            /**
+             * Should states that only differ by a permutation of symmetric PRISM modules be merged?
+             * @param newValue the new value (default true)
+             */
+            BuilderOptions& setSymmetryReduction(bool newValue = true);
+
+            /**
+             * Should the state rewards be left out during the exploration, such that the model builder can compute
+             * them in a separate pass over all states afterwards?
+             * @param newValue the new value (default true)
+             */
+            BuilderOptions& setDeferStateRewards(bool newValue = true);
+            
+            /**
+             * Sets the maximal distance (in steps) from the initial states up to which states are expanded.
+             * Note that this may interfere with checking properties that depend on an unbounded number of steps.
+             */
+            BuilderOptions& setMaximalExplorationDepth(uint64_t depth);
+
             /**
              * Sets the number of bits that will be reserved for unbounded integer variables.
              */
@@ -227,6 +266,9 @@ namespace storm {
             /// If one of these labels/expressions evaluates to the given bool, the builder can abort the exploration.
             std::vector<std::pair<LabelOrExpression, bool>> terminalStates;
             
+            /// If set, states whose distance to the initial states reaches this bound are not expanded.
+            boost::optional<uint64_t> maximalExplorationDepth;
+            
             /// A flag indicating whether the maximal progress assumption is applied when building a Markov Automaton.
             /// If this is true, Markovian edges are not explored from probabilistic states.
             bool applyMaximalProgressAssumption;
@@ -256,6 +298,15 @@ namespace storm {
             /// A flag indicating that the an additional state for out of bounds should be created.
             bool addOutOfBoundsState;
 
+            /// A flag indicating whether partial-order reduction is applied when exploring MDPs.
+            bool partialOrderReduction;
+
+            /// A flag indicating whether states are reduced with respect to symmetric modules.
+            bool symmetryReduction;
+
+            /// A flag indicating whether the state rewards are computed after the exploration.
+            bool deferStateRewards;
+
             /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
             uint64_t reservedBitsForUnboundedVariables;
 
@@ -1,14 +1,20 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <map>
+#include <type_traits>
 
 
 #include "storm/builder/RewardModelBuilder.h"
 #include "storm/builder/ChoiceInformationBuilder.h"
+#include "storm/builder/ParallelStateExpander.h"
 
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/generator/PrismNextStateGenerator.h"
 #include "storm/generator/JaniNextStateGenerator.h"
@@ -32,6 +38,7 @@
 #include "storm/utility/prism.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
 
 
@@ -46,13 +53,18 @@ namespace storm {
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
-            // Intentionally left empty.
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()), spillThreshold(storm::settings::getModule<storm::settings::modules::BuildSettings>().getSpillStatesThreshold()), numberOfExplorationThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationThreads()), explorationBatchSize(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationBatchSize()), numberOfRewardThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getRewardThreads()) {
+            auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+            if (buildSettings.isSpillStatesSet()) {
+                spillDirectory = buildSettings.getSpillStatesDirectory();
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options) : generator(generator), options(options), stateStorage(generator->getStateSize()) {
-            // Intentionally left empty.
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options) : generator(generator), options(options), stateStorage(generator->getStateSize()), statesToExplore(generator->getStateSize()) {
+            if (options.spillDirectory) {
+                stateStorage.enableSpilling(options.spillDirectory.get(), options.spillThreshold);
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
@@ -92,18 +104,16 @@ namespace storm {
             StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
             
             // Check, if the state was already registered.
-            std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
-            
-            StateType actualIndex = actualIndexBucketPair.first;
+            StateType actualIndex = stateStorage.findOrAdd(state, newIndex);
             
             if (actualIndex == newIndex) {
                 if (options.explorationOrder == ExplorationOrder::Dfs) {
-                    statesToExplore.emplace_front(state, actualIndex);
+                    statesToExplore.pushFront(state, actualIndex);
 
                     // Reserve one slot for the new state in the remapping.
                     stateRemapping.get().push_back(storm::utility::zero<StateType>());
                 } else if (options.explorationOrder == ExplorationOrder::Bfs) {
-                    statesToExplore.emplace_back(state, actualIndex);
+                    statesToExplore.pushBack(state, actualIndex);
                 } else {
                     STORM_LOG_ASSERT(false, "Invalid exploration order.");
                 }
@@ -114,11 +124,12 @@ namespace storm {
 
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportExplicitStateLookup() const {
+            STORM_LOG_THROW(!this->stateStorage.hasSpilledStates(), storm::exceptions::NotSupportedException, "Exporting the state lookup is not supported when states were spilled to disk.");
             return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
-        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates, boost::optional<storm::storage::sparse::StateValuationsBuilder>& stateValuationsBuilder) {
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates, boost::optional<storm::storage::sparse::StateValuationsBuilder>& stateValuationsBuilder, boost::optional<storm::storage::BitVector>& statesWithDeferredStateRewards) {
             
             // Create markovian states bit vector, if required.
             if (generator->getModelType() == storm::generator::ModelType::MA) {
@@ -149,12 +160,90 @@ namespace storm {
             uint64_t numberOfExploredStates = 0;
             uint64_t numberOfExploredStatesSinceLastMessage = 0;
             
+            // The state that is currently explored. It is reused for all states to avoid allocating memory for each of them.
+            CompressedState currentState(generator->getStateSize());
+            
+            // If the exploration depth is bounded, states at the maximal depth are not expanded. As states are explored in
+            // breadth-first order and their indices are assigned in the order of their discovery, the states of each
+            // depth form a contiguous range of indices that starts right after the states of the previous depth.
+            boost::optional<uint64_t> maximalExplorationDepth;
+            if (generator->getOptions().hasMaximalExplorationDepth()) {
+                if (options.explorationOrder == ExplorationOrder::Bfs) {
+                    maximalExplorationDepth = generator->getOptions().getMaximalExplorationDepth();
+                    STORM_LOG_INFO("Expanding states up to depth " << maximalExplorationDepth.get() << ".");
+                } else {
+                    STORM_LOG_WARN("The exploration depth can only be bounded when exploring states in breadth-first order. Exploring all states.");
+                }
+            }
+            uint64_t currentDepth = 0;
+            uint64_t numberOfUnexpandedStates = 0;
+            uint64_t firstStateOfNextDepth = this->stateStorage.getNumberOfStates();
+            
+            // If requested, the states are expanded in batches by multiple threads and the position of the current
+            // state in the last expanded batch is tracked.
+            std::unique_ptr<ParallelStateExpander<ValueType, StateType>> parallelExpander = createParallelStateExpander();
+            uint64_t positionInBatch = 0;
+            
             // Perform a search through the model.
-            while (!statesToExplore.empty()) {
-                // Get the first state in the queue.
-                CompressedState currentState = statesToExplore.front().first;
-                StateType currentIndex = statesToExplore.front().second;
-                statesToExplore.pop_front();
+            while (true) {
+                StateType currentIndex;
+                storm::generator::StateBehavior<ValueType, StateType> behavior;
+                if (parallelExpander) {
+                    if (positionInBatch == parallelExpander->getNumberOfExpandedStates()) {
+                        if (!parallelExpander->isBatchRunning()) {
+                            if (statesToExplore.empty()) {
+                                break;
+                            }
+                            parallelExpander->startBatch(statesToExplore);
+                        }
+                        parallelExpander->finishBatch();
+                        positionInBatch = 0;
+                        
+                        // Expand the states that are already queued while the results of the finished batch are added.
+                        if (!statesToExplore.empty()) {
+                            parallelExpander->startBatch(statesToExplore);
+                        }
+                    }
+                    
+                    // Get the next state of the batch. Resolving its behavior assigns the indices of its successors.
+                    currentIndex = parallelExpander->getExpandedState(positionInBatch, currentState);
+                    if (stateValuationsBuilder) {
+                        generator->load(currentState);
+                        generator->addStateValuation(currentIndex, stateValuationsBuilder.get());
+                    }
+                    behavior = parallelExpander->resolveBehavior(positionInBatch, stateToIdCallback);
+                    ++positionInBatch;
+                } else {
+                    if (statesToExplore.empty()) {
+                        break;
+                    }
+                    
+                    // Get the first state in the queue.
+                    statesToExplore.getFront(currentState);
+                    currentIndex = statesToExplore.getFrontValue();
+                    statesToExplore.popFront();
+                    
+                    generator->load(currentState);
+                    if (stateValuationsBuilder) {
+                        generator->addStateValuation(currentIndex, stateValuationsBuilder.get());
+                    }
+                    
+                    if (maximalExplorationDepth) {
+                        if (currentIndex >= firstStateOfNextDepth) {
+                            ++currentDepth;
+                            firstStateOfNextDepth = this->stateStorage.getNumberOfStates();
+                        }
+                        
+                        // A state at the maximal depth is treated like a terminal state, i.e., its behavior stays empty.
+                        if (currentDepth >= maximalExplorationDepth.get()) {
+                            ++numberOfUnexpandedStates;
+                        } else {
+                            behavior = generator->expand(stateToIdCallback);
+                        }
+                    } else {
+                        behavior = generator->expand(stateToIdCallback);
+                    }
+                }
                 
                 // If the exploration order differs from breadth-first, we remember that this row group was actually
                 // filled with the transitions of a different state.
@@ -166,12 +255,6 @@ namespace storm {
                     STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
                 }
                 
-                generator->load(currentState);
-                if (stateValuationsBuilder) {
-                    generator->addStateValuation(currentIndex, stateValuationsBuilder.get());
-                }
-                storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
-                
                 // If there is no behavior, we might have to introduce a self-loop.
                 if (behavior.empty()) {
                     if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
@@ -216,6 +299,12 @@ namespace storm {
                         ++stateRewardIt;
                     }
                     
+                    // If the generator left out the state rewards, remember that they need to be computed later.
+                    if (statesWithDeferredStateRewards) {
+                        statesWithDeferredStateRewards.get().grow(currentRowGroup + 1, false);
+                        statesWithDeferredStateRewards.get().set(currentRowGroup);
+                    }
+                    
                     // If the model is nondeterministic, we need to open a row group.
                     if (!generator->isDeterministicModel()) {
                         transitionMatrixBuilder.newRowGroup(currentRow);
@@ -281,6 +370,8 @@ namespace storm {
                 }
             }
             
+            STORM_LOG_INFO_COND(numberOfUnexpandedStates == 0, "Did not expand " << numberOfUnexpandedStates << " states at depth " << currentDepth << ".");
+            
             if (markovianStates) {
                 // Since we now know the correct size, cut the bit vector to the correct length.
                 markovianStates->resize(currentRowGroup, false);
@@ -308,12 +399,124 @@ namespace storm {
                 this->stateStorage.initialStateIndices = std::move(newInitialStateIndices);
                 
                 // Fix (c).
-                this->stateStorage.stateToId.remap([&remapping] (StateType const& state) { return remapping[state]; } );
+                this->stateStorage.remap([&remapping] (StateType const& state) { return remapping[state]; } );
 
                 this->generator->remapStateIds([&remapping] (StateType const& state) { return remapping[state]; });
             }
         }
         
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        std::unique_ptr<ParallelStateExpander<ValueType, StateType>> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::createParallelStateExpander() const {
+            if (options.numberOfExplorationThreads <= 1) {
+                return nullptr;
+            }
+            
+            if (!storm::NumberTraits<ValueType>::SupportsConcurrency) {
+                STORM_LOG_WARN("States are only expanded in parallel when building models with floating-point values. Falling back to sequential expansion.");
+                return nullptr;
+            }
+            // Partial-order reduction and the detection of overlapping guards need the final indices of states during the expansion.
+            if (generator->getOptions().isPartialOrderReductionSet() || generator->getOptions().isAddOverlappingGuardLabelSet()) {
+                STORM_LOG_WARN("States cannot be expanded in parallel when applying partial-order reduction or detecting overlapping guards. Falling back to sequential expansion.");
+                return nullptr;
+            }
+            // A depth-first search expands the successors of a state next, which requires the state to be resolved first.
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                STORM_LOG_WARN("States are only expanded in parallel for breadth-first exploration. Falling back to sequential expansion.");
+                return nullptr;
+            }
+            // Whether a state is expanded depends on its depth, which is only known once the state is taken from the queue.
+            if (generator->getOptions().hasMaximalExplorationDepth()) {
+                STORM_LOG_WARN("States cannot be expanded in parallel when the exploration depth is bounded. Falling back to sequential expansion.");
+                return nullptr;
+            }
+            if (!generator->clone()) {
+                STORM_LOG_WARN("The generator does not support expanding states in parallel. Falling back to sequential expansion.");
+                return nullptr;
+            }
+            
+            STORM_LOG_INFO("Expanding states with " << options.numberOfExplorationThreads << " threads in batches of " << options.explorationBatchSize << " states.");
+            return storm::builder::createParallelStateExpander(*generator, options.numberOfExplorationThreads, options.explorationBatchSize);
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildDeferredStateRewards(std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, storm::storage::BitVector const& states) {
+            uint64_t numberOfThreads = std::max<uint64_t>(options.numberOfRewardThreads, 1);
+            if (numberOfThreads > 1 && (!storm::NumberTraits<ValueType>::SupportsConcurrency || !storm::NumberTraits<typename RewardModelType::ValueType>::SupportsConcurrency)) {
+                STORM_LOG_WARN("State rewards are only computed in parallel when building models with floating-point values. Falling back to a single thread.");
+                numberOfThreads = 1;
+            }
+            
+            // Every thread evaluates the rewards with its own generator, as the generators keep the loaded state.
+            std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> generators = {generator};
+            for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                generators.push_back(generator->clone());
+                if (!generators.back()) {
+                    STORM_LOG_WARN("The generator does not support computing state rewards in parallel. Falling back to a single thread.");
+                    generators.resize(1);
+                    break;
+                }
+            }
+            
+            // Gather the states in the order of their indices, such that ranges of states can be processed independently.
+            uint64_t numberOfStates = states.size();
+            STORM_LOG_ASSERT((generator->getStateSize() & 63) == 0, "State size must be a multiple of 64.");
+            uint64_t wordsPerState = generator->getStateSize() >> 6;
+            std::vector<uint64_t> stateWords(numberOfStates * wordsPerState);
+            stateStorage.forEachState([&states, &stateWords, wordsPerState] (storm::storage::BitVector const& state, StateType const& index) {
+                if (states.get(index)) {
+                    for (uint64_t word = 0; word < wordsPerState; ++word) {
+                        stateWords[index * wordsPerState + word] = state.getAsInt(word << 6, 64);
+                    }
+                }
+            });
+            
+            // Create one task for every reward model with state rewards and range of states.
+            std::vector<std::pair<uint64_t, uint64_t>> tasks;
+            uint64_t statesPerTask = std::max<uint64_t>(1, (numberOfStates + generators.size() - 1) / generators.size());
+            for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelBuilders.size(); ++rewardModelIndex) {
+                if (rewardModelBuilders[rewardModelIndex].hasStateRewards()) {
+                    for (uint64_t firstState = 0; firstState < numberOfStates; firstState += statesPerTask) {
+                        tasks.emplace_back(rewardModelIndex, firstState);
+                    }
+                }
+            }
+            
+            STORM_LOG_INFO("Computing state rewards of " << states.getNumberOfSetBits() << " states in " << tasks.size() << " tasks using " << generators.size() << " thread(s).");
+            std::atomic<uint64_t> nextTask(0);
+            auto processTasks = [&] (storm::generator::NextStateGenerator<ValueType, StateType>& taskGenerator) {
+                CompressedState state(generator->getStateSize());
+                for (uint64_t task = nextTask++; task < tasks.size(); task = nextTask++) {
+                    RewardModelBuilder<typename RewardModelType::ValueType>& rewardModelBuilder = rewardModelBuilders[tasks[task].first];
+                    uint64_t lastState = std::min(tasks[task].second + statesPerTask, numberOfStates);
+                    for (uint64_t stateIndex = states.getNextSetIndex(tasks[task].second); stateIndex < lastState; stateIndex = states.getNextSetIndex(stateIndex + 1)) {
+                        for (uint64_t word = 0; word < wordsPerState; ++word) {
+                            state.setFromInt(word << 6, 64, stateWords[stateIndex * wordsPerState + word]);
+                        }
+                        taskGenerator.load(state);
+                        rewardModelBuilder.setStateReward(stateIndex, taskGenerator.evaluateStateReward(tasks[task].first));
+                    }
+                }
+            };
+            
+            if (generators.size() == 1) {
+                processTasks(*generator);
+            } else {
+                std::vector<std::future<void>> results;
+                for (auto& threadGenerator : generators) {
+                    results.push_back(std::async(std::launch::async, [&processTasks, &threadGenerator] () { processTasks(*threadGenerator); }));
+                }
+                
+                // Wait for all threads before rethrowing an exception, such that none of them refers to the tasks anymore.
+                for (auto& result : results) {
+                    result.wait();
+                }
+                for (auto& result : results) {
+                    result.get();
+                }
+            }
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
         storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
             
@@ -336,7 +539,19 @@ namespace storm {
                 stateValuationsBuilder = generator->initializeStateValuationsBuilder();
             }
             
-            buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, stateValuationsBuilder);
+            // If the generator leaves out the state rewards, we need to keep track of the states for which they are to be computed.
+            boost::optional<storm::storage::BitVector> statesWithDeferredStateRewards;
+            if (generator->isStateRewardEvaluationDeferred() && std::any_of(rewardModelBuilders.begin(), rewardModelBuilders.end(), [] (RewardModelBuilder<typename RewardModelType::ValueType> const& rewardModelBuilder) { return rewardModelBuilder.hasStateRewards(); })) {
+                // The bit vector will be resized when the correct size is known.
+                statesWithDeferredStateRewards = storm::storage::BitVector(1000);
+            }
+            
+            buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, stateValuationsBuilder, statesWithDeferredStateRewards);
+            
+            if (statesWithDeferredStateRewards) {
+                statesWithDeferredStateRewards->resize(stateStorage.getNumberOfStates(), false);
+                buildDeferredStateRewards(rewardModelBuilders, statesWithDeferredStateRewards.get());
+            }
             
             // Initialize the model components with the obtained information.
             storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), buildStateLabeling(), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel(), std::move(markovianStates));
@@ -361,6 +576,7 @@ namespace storm {
                 uint32_t newObservation = 0;
                 classes.resize(stateStorage.getNumberOfStates());
                 std::unordered_map<uint32_t, std::vector<std::pair<std::vector<std::string>, uint32_t>>> observationActions;
+                STORM_LOG_THROW(!stateStorage.hasSpilledStates(), storm::exceptions::NotSupportedException, "Spilling states to disk is not supported for partially observable models.");
                 for (auto const& bitVectorIndexPair : stateStorage.stateToId) {
                     uint32_t varObservation = generator->observabilityClass(bitVectorIndexPair.first);
                     uint32_t observation = -1; // Is replaced later on.
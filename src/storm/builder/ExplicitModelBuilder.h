@@ -4,7 +4,6 @@
 #include <memory>
 #include <utility>
 #include <vector>
-#include <deque>
 #include <cstdint>
 #include <boost/functional/hash.hpp>
 #include <boost/container/flat_map.hpp>
@@ -21,6 +20,7 @@
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/storage/sparse/StateStorage.h"
+#include "storm/storage/BitVectorDeque.h"
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/utility/prism.h"
@@ -43,6 +43,7 @@ namespace storm {
         
         // Forward-declare classes.
         template <typename ValueType> class RewardModelBuilder;
+        template <typename ValueType, typename StateType> class ParallelStateExpander;
         class ChoiceInformationBuilder;
 
         template<typename StateType>
@@ -72,6 +73,23 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+                
+                // If set, explored states are spilled to files in this directory.
+                boost::optional<std::string> spillDirectory;
+                
+                // The number of states that are held in memory before they are spilled to disk.
+                uint64_t spillThreshold;
+                
+                // The number of threads that expand states. If more than one thread is used, states are expanded in
+                // batches by copies of the generator.
+                uint64_t numberOfExplorationThreads;
+                
+                // The number of states that are expanded in one batch if multiple threads are used.
+                uint64_t explorationBatchSize;
+                
+                // The number of threads that compute the state rewards if the generator leaves them out during the
+                // exploration.
+                uint64_t numberOfRewardThreads;
             };
             
             /*!
@@ -130,8 +148,28 @@ namespace storm {
              * @param choiceInformationBuilder The builder for the requested information of the choices
              * @param markovianChoices is set to a bit vector storing whether a choice is Markovian (is only set if the model type requires this information).
              * @param stateValuationsBuilder if not boost::none, we insert valuations for the corresponding states
+             * @param statesWithDeferredStateRewards if not boost::none, it is set to a bit vector storing the states whose state rewards were left out by the generator.
+             */
+            void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices, boost::optional<storm::storage::sparse::StateValuationsBuilder>& stateValuationsBuilder, boost::optional<storm::storage::BitVector>& statesWithDeferredStateRewards);
+            
+            /*!
+             * Computes the state rewards that were left out during the exploration. The work is split into tasks, each
+             * of which evaluates the rewards of one reward model for a range of states, such that the result does not
+             * depend on the number of threads.
+             *
+             * @param rewardModelBuilders The builders for the selected reward models. Their state rewards are overwritten.
+             * @param states The states whose state rewards are to be computed.
+             */
+            void buildDeferredStateRewards(std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, storm::storage::BitVector const& states);
+            
+            /*!
+             * Creates the expander used to expand states in parallel, if multiple exploration threads were requested
+             * and the generator supports it. As only a breadth-first exploration is not affected by expanding several
+             * states at once, the resulting model is then identical to the one built sequentially.
+             *
+             * @return The expander or nullptr if states are to be expanded sequentially.
              */
-            void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices, boost::optional<storm::storage::sparse::StateValuationsBuilder>& stateValuationsBuilder);
+            std::unique_ptr<ParallelStateExpander<ValueType, StateType>> createParallelStateExpander() const;
             
             /*!
              * Explores the state space of the given program and returns the components of the model as a result.
@@ -157,7 +195,7 @@ namespace storm {
             storm::storage::sparse::StateStorage<StateType> stateStorage;
             
             /// A set of states that still need to be explored.
-            std::deque<std::pair<CompressedState, StateType>> statesToExplore;
+            storm::storage::BitVectorDeque<StateType> statesToExplore;
             
             /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
             /// built in case the exploration order is not BFS.
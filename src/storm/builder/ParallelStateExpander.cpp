@@ -0,0 +1,241 @@
+#include "storm/builder/ParallelStateExpander.h"
+
+#include <algorithm>
+#include <future>
+
+#include "storm/storage/BitVectorHashMap.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace builder {
+
+        /*!
+         * Expands the states of a batch by running one worker per slice of the batch asynchronously.
+         */
+        template<typename ValueType, typename StateType>
+        class ConcurrentStateExpander : public ParallelStateExpander<ValueType, StateType> {
+        public:
+            typedef typename ParallelStateExpander<ValueType, StateType>::StateToIdCallback StateToIdCallback;
+
+            ConcurrentStateExpander(storm::generator::NextStateGenerator<ValueType, StateType> const& generator, uint64_t numberOfThreads, uint64_t batchSize);
+            virtual ~ConcurrentStateExpander();
+
+            virtual void startBatch(storm::storage::BitVectorDeque<StateType>& statesToExplore) override;
+            virtual bool isBatchRunning() const override;
+            virtual void finishBatch() override;
+            virtual uint64_t getNumberOfExpandedStates() const override;
+            virtual StateType getExpandedState(uint64_t position, storm::generator::CompressedState& state) const override;
+            virtual storm::generator::StateBehavior<ValueType, StateType> resolveBehavior(uint64_t position, StateToIdCallback const& stateToIdCallback) override;
+
+        private:
+            struct Slice {
+                // The first and last (exclusive) position of the states in the batch that belong to this slice.
+                uint64_t begin;
+                uint64_t end;
+
+                // The preliminary indices of the successor states found in this slice.
+                storm::storage::BitVectorHashMap<StateType> successorToLocalIndex;
+
+                // The words of the successor states, ordered by their preliminary indices.
+                std::vector<uint64_t> successorWords;
+
+                // The indices of the successors that were resolved so far.
+                std::vector<StateType> localToGlobalIndex;
+            };
+
+            struct Batch {
+                // The words of the states of the batch.
+                std::vector<uint64_t> stateWords;
+
+                // The indices of the states of the batch.
+                std::vector<StateType> stateIndices;
+
+                // The behaviors of the states of the batch.
+                std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+
+                // For each state, the number of successors of its slice that were found up to (including) the state.
+                std::vector<uint64_t> numberOfSuccessors;
+
+                // The slices of the batch, one per worker.
+                std::vector<Slice> slices;
+
+                // The results of the workers.
+                std::vector<std::future<void>> results;
+            };
+
+            /*!
+             * Expands all states of the given slice using the given generator.
+             */
+            void expandSlice(Batch& batch, Slice& slice, storm::generator::NextStateGenerator<ValueType, StateType>& generator);
+
+            // The number of words of a state.
+            uint64_t wordsPerState;
+
+            // The maximal number of states per batch.
+            uint64_t batchSize;
+
+            // The generators of the workers.
+            std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> generators;
+
+            // The batch that is being expanded (if any) and the last batch that was finished.
+            std::unique_ptr<Batch> runningBatch;
+            std::unique_ptr<Batch> finishedBatch;
+
+            // A flag indicating whether a batch is currently running.
+            bool batchRunning;
+
+            // A state used to pass the successors to the callback.
+            storm::generator::CompressedState successor;
+        };
+
+        template<typename ValueType, typename StateType>
+        ConcurrentStateExpander<ValueType, StateType>::ConcurrentStateExpander(storm::generator::NextStateGenerator<ValueType, StateType> const& generator, uint64_t numberOfThreads, uint64_t batchSize) : wordsPerState(generator.getStateSize() >> 6), batchSize(std::max<uint64_t>(batchSize, 1)), runningBatch(std::make_unique<Batch>()), finishedBatch(std::make_unique<Batch>()), batchRunning(false), successor(generator.getStateSize()) {
+            STORM_LOG_ASSERT((generator.getStateSize() & 63) == 0, "State size must be a multiple of 64.");
+            for (uint64_t thread = 0; thread < std::max<uint64_t>(numberOfThreads, 1); ++thread) {
+                generators.push_back(generator.clone());
+                STORM_LOG_THROW(generators.back() != nullptr, storm::exceptions::InvalidArgumentException, "The generator cannot be copied to expand states in parallel.");
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        ConcurrentStateExpander<ValueType, StateType>::~ConcurrentStateExpander() {
+            // Wait for a running batch to finish, as its workers refer to this object.
+            for (auto& result : runningBatch->results) {
+                if (result.valid()) {
+                    result.wait();
+                }
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        void ConcurrentStateExpander<ValueType, StateType>::startBatch(storm::storage::BitVectorDeque<StateType>& statesToExplore) {
+            STORM_LOG_ASSERT(!batchRunning, "Cannot start a batch while another one is running.");
+            Batch& batch = *runningBatch;
+
+            // Take the states from the queue.
+            uint64_t numberOfStates = std::min<uint64_t>(batchSize, statesToExplore.size());
+            batch.stateWords.resize(numberOfStates * wordsPerState);
+            batch.stateIndices.resize(numberOfStates);
+            for (uint64_t position = 0; position < numberOfStates; ++position) {
+                statesToExplore.getFront(successor);
+                for (uint64_t word = 0; word < wordsPerState; ++word) {
+                    batch.stateWords[position * wordsPerState + word] = successor.getAsInt(word << 6, 64);
+                }
+                batch.stateIndices[position] = statesToExplore.getFrontValue();
+                statesToExplore.popFront();
+            }
+            batch.behaviors.clear();
+            batch.behaviors.resize(numberOfStates);
+            batch.numberOfSuccessors.resize(numberOfStates);
+
+            // Split the batch into contiguous slices, one per worker.
+            uint64_t numberOfSlices = std::min<uint64_t>(generators.size(), numberOfStates);
+            uint64_t statesPerSlice = numberOfSlices == 0 ? 0 : (numberOfStates + numberOfSlices - 1) / numberOfSlices;
+            batch.slices.resize(numberOfSlices);
+            batch.results.clear();
+            for (uint64_t sliceIndex = 0; sliceIndex < numberOfSlices; ++sliceIndex) {
+                Slice& slice = batch.slices[sliceIndex];
+                slice.begin = std::min(sliceIndex * statesPerSlice, numberOfStates);
+                slice.end = std::min(slice.begin + statesPerSlice, numberOfStates);
+                slice.successorToLocalIndex = storm::storage::BitVectorHashMap<StateType>(wordsPerState << 6, 4 * (slice.end - slice.begin) + 16);
+                slice.successorWords.clear();
+                slice.localToGlobalIndex.clear();
+
+                storm::generator::NextStateGenerator<ValueType, StateType>& generator = *generators[sliceIndex];
+                batch.results.push_back(std::async(std::launch::async, [this, &batch, &slice, &generator] () { expandSlice(batch, slice, generator); }));
+            }
+            batchRunning = true;
+        }
+
+        template<typename ValueType, typename StateType>
+        bool ConcurrentStateExpander<ValueType, StateType>::isBatchRunning() const {
+            return batchRunning;
+        }
+
+        template<typename ValueType, typename StateType>
+        void ConcurrentStateExpander<ValueType, StateType>::finishBatch() {
+            STORM_LOG_ASSERT(batchRunning, "There is no running batch.");
+            batchRunning = false;
+            std::swap(runningBatch, finishedBatch);
+
+            // Wait for all workers before rethrowing an exception, such that none of them refers to the batch anymore.
+            for (auto& result : finishedBatch->results) {
+                result.wait();
+            }
+            for (auto& result : finishedBatch->results) {
+                result.get();
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        uint64_t ConcurrentStateExpander<ValueType, StateType>::getNumberOfExpandedStates() const {
+            return finishedBatch->stateIndices.size();
+        }
+
+        template<typename ValueType, typename StateType>
+        StateType ConcurrentStateExpander<ValueType, StateType>::getExpandedState(uint64_t position, storm::generator::CompressedState& state) const {
+            if (state.size() != wordsPerState << 6) {
+                state = storm::generator::CompressedState(wordsPerState << 6);
+            }
+            for (uint64_t word = 0; word < wordsPerState; ++word) {
+                state.setFromInt(word << 6, 64, finishedBatch->stateWords[position * wordsPerState + word]);
+            }
+            return finishedBatch->stateIndices[position];
+        }
+
+        template<typename ValueType, typename StateType>
+        storm::generator::StateBehavior<ValueType, StateType> ConcurrentStateExpander<ValueType, StateType>::resolveBehavior(uint64_t position, StateToIdCallback const& stateToIdCallback) {
+            Batch& batch = *finishedBatch;
+            uint64_t statesPerSlice = batch.slices.front().end - batch.slices.front().begin;
+            Slice& slice = batch.slices[position / statesPerSlice];
+
+            // The successors that were first found when expanding this state obtain their index now. Since preliminary
+            // indices are handed out in the order in which successors are requested, this is the order in which a
+            // sequential expansion would have requested them.
+            uint64_t firstSuccessor = position == slice.begin ? 0 : batch.numberOfSuccessors[position - 1];
+            for (uint64_t local = firstSuccessor; local < batch.numberOfSuccessors[position]; ++local) {
+                STORM_LOG_ASSERT(slice.localToGlobalIndex.size() == local, "Successors were resolved out of order.");
+                for (uint64_t word = 0; word < wordsPerState; ++word) {
+                    successor.setFromInt(word << 6, 64, slice.successorWords[local * wordsPerState + word]);
+                }
+                slice.localToGlobalIndex.push_back(stateToIdCallback(successor));
+            }
+
+            storm::generator::StateBehavior<ValueType, StateType> behavior = std::move(batch.behaviors[position]);
+            for (auto& choice : behavior.getChoices()) {
+                choice.remapStates(slice.localToGlobalIndex);
+            }
+            return behavior;
+        }
+
+        template<typename ValueType, typename StateType>
+        void ConcurrentStateExpander<ValueType, StateType>::expandSlice(Batch& batch, Slice& slice, storm::generator::NextStateGenerator<ValueType, StateType>& generator) {
+            StateToIdCallback localStateToIdCallback = [this, &slice] (storm::generator::CompressedState const& state) {
+                StateType newIndex = static_cast<StateType>(slice.successorToLocalIndex.size());
+                StateType index = slice.successorToLocalIndex.findOrAdd(state, newIndex);
+                if (index == newIndex) {
+                    for (uint64_t word = 0; word < wordsPerState; ++word) {
+                        slice.successorWords.push_back(state.getAsInt(word << 6, 64));
+                    }
+                }
+                return index;
+            };
+
+            storm::generator::CompressedState state(wordsPerState << 6);
+            for (uint64_t position = slice.begin; position < slice.end; ++position) {
+                for (uint64_t word = 0; word < wordsPerState; ++word) {
+                    state.setFromInt(word << 6, 64, batch.stateWords[position * wordsPerState + word]);
+                }
+                generator.load(state);
+                batch.behaviors[position] = generator.expand(localStateToIdCallback);
+                batch.numberOfSuccessors[position] = slice.successorToLocalIndex.size();
+            }
+        }
+
+        std::unique_ptr<ParallelStateExpander<double, uint32_t>> createParallelStateExpander(storm::generator::NextStateGenerator<double, uint32_t> const& generator, uint64_t numberOfThreads, uint64_t batchSize) {
+            return std::make_unique<ConcurrentStateExpander<double, uint32_t>>(generator, numberOfThreads, batchSize);
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/StateBehavior.h"
+#include "storm/storage/BitVectorDeque.h"
+
+namespace storm {
+    namespace builder {
+
+        /*!
+         * Expands batches of states concurrently using independent copies of a next-state generator.
+         *
+         * Since the workers must not assign the global indices of states, they hand out preliminary indices for
+         * successor states that are local to the portion of the batch processed by a worker. Once a batch was
+         * expanded, the caller resolves the behaviors state by state, which assigns the global indices in the same
+         * order in which a sequential expansion of the same states would have requested them. While the results of
+         * one batch are resolved, the next batch can already be expanded in the background.
+         */
+        template<typename ValueType, typename StateType>
+        class ParallelStateExpander {
+        public:
+            typedef typename storm::generator::NextStateGenerator<ValueType, StateType>::StateToIdCallback StateToIdCallback;
+
+            virtual ~ParallelStateExpander() = default;
+
+            /*!
+             * Takes up to the batch size many states from the front of the given queue and starts expanding them in the
+             * background. No other batch may be running.
+             *
+             * @param statesToExplore The queue from which to take the states.
+             */
+            virtual void startBatch(storm::storage::BitVectorDeque<StateType>& statesToExplore) = 0;
+
+            /*!
+             * Retrieves whether a batch is currently being expanded.
+             */
+            virtual bool isBatchRunning() const = 0;
+
+            /*!
+             * Waits for the running batch to finish, which makes its results available and discards the ones of the
+             * previously finished batch. Exceptions raised while expanding the states are rethrown.
+             */
+            virtual void finishBatch() = 0;
+
+            /*!
+             * Retrieves the number of states of the finished batch.
+             */
+            virtual uint64_t getNumberOfExpandedStates() const = 0;
+
+            /*!
+             * Retrieves a state of the finished batch.
+             *
+             * @param position The position of the state within the batch.
+             * @param state The state is copied into this compressed state.
+             * @return The index of the state.
+             */
+            virtual StateType getExpandedState(uint64_t position, storm::generator::CompressedState& state) const = 0;
+
+            /*!
+             * Retrieves the behavior of a state of the finished batch, in which the preliminary indices of the
+             * successor states are replaced by the indices obtained from the given callback. The states need to be
+             * resolved in the order of their positions.
+             *
+             * @param position The position of the state within the batch.
+             * @param stateToIdCallback The callback that is used to retrieve the index of the successors.
+             * @return The behavior of the state.
+             */
+            virtual storm::generator::StateBehavior<ValueType, StateType> resolveBehavior(uint64_t position, StateToIdCallback const& stateToIdCallback) = 0;
+        };
+
+        /*!
+         * Creates an expander whose workers use copies of the given generator. States are only expanded in parallel
+         * for floating-point values (see NumberTraits::SupportsConcurrency).
+         *
+         * @param generator The generator to copy. It must support copying.
+         * @param numberOfThreads The number of threads expanding the states of a batch.
+         * @param batchSize The maximal number of states per batch.
+         * @return The expander or null if the value type is not supported.
+         */
+        template<typename ValueType, typename StateType>
+        std::unique_ptr<ParallelStateExpander<ValueType, StateType>> createParallelStateExpander(storm::generator::NextStateGenerator<ValueType, StateType> const&, uint64_t, uint64_t) {
+            return nullptr;
+        }
+
+        std::unique_ptr<ParallelStateExpander<double, uint32_t>> createParallelStateExpander(storm::generator::NextStateGenerator<double, uint32_t> const& generator, uint64_t numberOfThreads, uint64_t batchSize);
+
+    }
+}
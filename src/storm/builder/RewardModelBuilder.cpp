@@ -42,6 +42,12 @@ namespace storm {
             stateRewardVector.push_back(value);
         }
         
+        template <typename ValueType>
+        void RewardModelBuilder<ValueType>::setStateReward(uint_fast64_t state, ValueType const& value) {
+            STORM_LOG_ASSERT(state < stateRewardVector.size(), "Cannot set the reward of state " << state << " as it was not added yet.");
+            stateRewardVector[state] = value;
+        }
+        
         template <typename ValueType>
         void RewardModelBuilder<ValueType>::addStateActionReward(ValueType const& value) {
             stateActionRewardVector.push_back(value);
@@ -28,6 +28,15 @@ namespace storm {
             
             void addStateReward(ValueType const& value);
             
+            /*!
+             * Overwrites the state reward of a state that was already added. Since no other data is modified, this
+             * may be called concurrently for different states.
+             *
+             * @param state The index of the state.
+             * @param value The new state reward.
+             */
+            void setStateReward(uint_fast64_t state, ValueType const& value);
+            
             void addStateActionReward(ValueType const& value);
             
             bool hasStateRewards() const;
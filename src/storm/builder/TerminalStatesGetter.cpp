@@ -2,30 +2,43 @@
 
 #include "storm/storage/expressions/Expression.h"
 #include "storm/logic/Formulas.h"
+#include "storm/logic/FragmentSpecification.h"
 
 namespace storm {
     namespace builder {
+        namespace {
+            /*!
+             * Calls the callbacks for expressions (or labels) such that the given propositional formula has the given value in all states satisfying
+             * (or violating) the expression (or label). Negations, disjunctions that are to be satisfied and conjunctions that are to be violated are
+             * split into their operands.
+             */
+            void getStatesWithValue(storm::logic::Formula const& formula, bool value, std::function<void(storm::expressions::Expression const&, bool)> const& terminalExpressionCallback, std::function<void(std::string const&, bool)> const& terminalLabelCallback) {
+                if (formula.isAtomicExpressionFormula()) {
+                    terminalExpressionCallback(formula.asAtomicExpressionFormula().getExpression(), value);
+                } else if (formula.isAtomicLabelFormula()) {
+                    terminalLabelCallback(formula.asAtomicLabelFormula().getLabel(), value);
+                } else if (formula.isUnaryBooleanStateFormula()) {
+                    if (formula.asUnaryBooleanStateFormula().isNot()) {
+                        getStatesWithValue(formula.asUnaryBooleanStateFormula().getSubformula(), !value, terminalExpressionCallback, terminalLabelCallback);
+                    }
+                } else if (formula.isBinaryBooleanStateFormula()) {
+                    storm::logic::BinaryBooleanStateFormula const& binaryFormula = formula.asBinaryBooleanStateFormula();
+                    if ((value && binaryFormula.isOr()) || (!value && binaryFormula.isAnd())) {
+                        getStatesWithValue(binaryFormula.getLeftSubformula(), value, terminalExpressionCallback, terminalLabelCallback);
+                        getStatesWithValue(binaryFormula.getRightSubformula(), value, terminalExpressionCallback, terminalLabelCallback);
+                    }
+                }
+            }
+        }
+        
         void getTerminalStatesFromFormula(storm::logic::Formula const& formula, std::function<void(storm::expressions::Expression const&, bool)> const& terminalExpressionCallback, std::function<void(std::string const&, bool)> const& terminalLabelCallback) {
-            if (formula.isAtomicExpressionFormula()) {
-                terminalExpressionCallback(formula.asAtomicExpressionFormula().getExpression(), true);
-            } else if (formula.isAtomicLabelFormula()) {
-                terminalLabelCallback(formula.asAtomicLabelFormula().getLabel(), true);
+            if (formula.isAtomicExpressionFormula() || formula.isAtomicLabelFormula()) {
+                getStatesWithValue(formula, true, terminalExpressionCallback, terminalLabelCallback);
             } else if (formula.isEventuallyFormula()) {
-                storm::logic::Formula const& sub = formula.asEventuallyFormula().getSubformula();
-                if (sub.isAtomicExpressionFormula() || sub.isAtomicLabelFormula()) {
-                    getTerminalStatesFromFormula(sub, terminalExpressionCallback, terminalLabelCallback);
-                }
+                getStatesWithValue(formula.asEventuallyFormula().getSubformula(), true, terminalExpressionCallback, terminalLabelCallback);
             } else if (formula.isUntilFormula()) {
-                storm::logic::Formula const& right = formula.asUntilFormula().getRightSubformula();
-                if (right.isAtomicExpressionFormula() || right.isAtomicLabelFormula()) {
-                    getTerminalStatesFromFormula(right, terminalExpressionCallback, terminalLabelCallback);
-                }
-                storm::logic::Formula const& left = formula.asUntilFormula().getLeftSubformula();
-                if (left.isAtomicExpressionFormula()) {
-                    terminalExpressionCallback(left.asAtomicExpressionFormula().getExpression(), false);
-                } else if (left.isAtomicLabelFormula()) {
-                    terminalLabelCallback(left.asAtomicLabelFormula().getLabel(), false);
-                }
+                getStatesWithValue(formula.asUntilFormula().getRightSubformula(), true, terminalExpressionCallback, terminalLabelCallback);
+                getStatesWithValue(formula.asUntilFormula().getLeftSubformula(), false, terminalExpressionCallback, terminalLabelCallback);
             } else if (formula.isBoundedUntilFormula()) {
                 storm::logic::BoundedUntilFormula const& boundedUntil = formula.asBoundedUntilFormula();
                 bool hasLowerBound = false;
@@ -36,17 +49,9 @@ namespace storm {
                     }
                 }
                 if (!hasLowerBound) {
-                    storm::logic::Formula const& right = boundedUntil.getRightSubformula();
-                    if (right.isAtomicExpressionFormula() || right.isAtomicLabelFormula()) {
-                        getTerminalStatesFromFormula(right, terminalExpressionCallback, terminalLabelCallback);
-                    }
-                }
-                storm::logic::Formula const& left = boundedUntil.getLeftSubformula();
-                if (left.isAtomicExpressionFormula()) {
-                    terminalExpressionCallback(left.asAtomicExpressionFormula().getExpression(), false);
-                } else if (left.isAtomicLabelFormula()) {
-                    terminalLabelCallback(left.asAtomicLabelFormula().getLabel(), false);
+                    getStatesWithValue(boundedUntil.getRightSubformula(), true, terminalExpressionCallback, terminalLabelCallback);
                 }
+                getStatesWithValue(boundedUntil.getLeftSubformula(), false, terminalExpressionCallback, terminalLabelCallback);
             } else if (formula.isProbabilityOperatorFormula()) {
                 storm::logic::Formula const& sub = formula.asProbabilityOperatorFormula().getSubformula();
                 if (sub.isEventuallyFormula() || sub.isUntilFormula() || sub.isBoundedUntilFormula()) {
@@ -60,6 +65,36 @@ namespace storm {
             }
         }
         
+        boost::optional<uint64_t> getExplorationDepthFromFormula(storm::logic::Formula const& formula) {
+            // Only if the subformulas are propositional, their value in a state does not depend on the successors of the state.
+            storm::logic::FragmentSpecification propositional = storm::logic::propositional();
+            if (formula.isProbabilityOperatorFormula()) {
+                storm::logic::Formula const& sub = formula.asProbabilityOperatorFormula().getSubformula();
+                if (sub.isNextFormula()) {
+                    if (sub.asNextFormula().getSubformula().isInFragment(propositional)) {
+                        return 1;
+                    }
+                } else if (sub.isBoundedUntilFormula()) {
+                    storm::logic::BoundedUntilFormula const& boundedUntil = sub.asBoundedUntilFormula();
+                    if (!boundedUntil.isMultiDimensional() && !boundedUntil.getTimeBoundReference().isRewardBound() && boundedUntil.hasUpperBound() && boundedUntil.hasIntegerUpperBound() && !boundedUntil.getUpperBound().containsVariables() && (!boundedUntil.isUpperBoundStrict() || boundedUntil.getUpperBound<uint64_t>() > 0) && boundedUntil.getLeftSubformula().isInFragment(propositional) && boundedUntil.getRightSubformula().isInFragment(propositional)) {
+                        // A path satisfies the formula if and only if its prefix of the given length does, so the states first reached
+                        // after this number of steps are relevant only for their labels.
+                        return boundedUntil.getNonStrictUpperBound<uint64_t>();
+                    }
+                }
+            } else if (formula.isRewardOperatorFormula()) {
+                // Instantaneous rewards are not considered, as the states that are not expanded do not obtain rewards.
+                storm::logic::Formula const& sub = formula.asRewardOperatorFormula().getSubformula();
+                if (sub.isCumulativeRewardFormula()) {
+                    storm::logic::CumulativeRewardFormula const& cumulativeReward = sub.asCumulativeRewardFormula();
+                    if (!cumulativeReward.isMultiDimensional() && !cumulativeReward.getTimeBoundReference().isRewardBound() && cumulativeReward.hasIntegerBound() && !cumulativeReward.getBound().containsVariables() && (!cumulativeReward.isBoundStrict() || cumulativeReward.getBound<uint64_t>() > 0)) {
+                        return cumulativeReward.getNonStrictBound<uint64_t>();
+                    }
+                }
+            }
+            return boost::none;
+        }
+        
         void TerminalStates::clear() {
             terminalExpressions.clear();
             negatedTerminalExpressions.clear();
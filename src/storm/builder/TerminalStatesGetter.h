@@ -4,6 +4,8 @@
 #include <string>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 namespace storm {
     
     namespace expressions {
@@ -24,6 +26,13 @@ namespace storm {
          */
         void getTerminalStatesFromFormula(storm::logic::Formula const& formula, std::function<void(storm::expressions::Expression const&, bool)> const& terminalExpressionCallback, std::function<void(std::string const&, bool)> const& terminalLabelCallback);
         
+        /*!
+         * Determines the number of steps after which checking the formula on a discrete-time model does not require further exploration, i.e.,
+         * states whose distance to the initial states is at least this number need not be expanded.
+         * @param formula The formula to analyze
+         * @return The number of steps, if the formula only depends on a bounded number of steps.
+         */
+        boost::optional<uint64_t> getExplorationDepthFromFormula(storm::logic::Formula const& formula);
         
         struct TerminalStates {
             std::vector<storm::expressions::Expression> terminalExpressions; // if one of these is true, we can stop exploration
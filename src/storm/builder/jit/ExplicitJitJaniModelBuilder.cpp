@@ -5,6 +5,8 @@
 #include <chrono>
 #include <errno.h>
 
+#include <boost/functional/hash.hpp>
+
 #include "storm/solver/SmtSolver.h"
 
 #include "storm/storage/jani/Edge.h"
@@ -137,6 +139,9 @@ namespace storm {
                 gmpIncludeDirectory = "";
 #endif
                 sparseppIncludeDirectory = STORM_BUILD_DIR "/include/resources/3rdparty/sparsepp/";
+                if (settings.isCacheDirectorySet()) {
+                    cacheDirectory = boost::filesystem::path(settings.getCacheDirectory());
+                }
                 
                 // Register all transient variables as transient.
                 for (auto const& variable : this->model.getGlobalVariables().getTransientVariables()) {
@@ -524,15 +529,30 @@ namespace storm {
                 }
                 STORM_LOG_TRACE("Successfully created source code for model generation: " << source);
                 
-                // (2) Write the source code to a temporary file.
-                boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
-                
-                // (3) Compile the source code to a shared library.
-                boost::filesystem::path dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
-                STORM_LOG_TRACE("Successfully compiled shared library.");
+                // (2) Check whether the cache already contains a shared library for this source code.
+                boost::filesystem::path dynamicLibraryPath;
+                bool libraryIsCached = false;
+                if (cacheDirectory) {
+                    dynamicLibraryPath = getCachedSharedLibraryPath(source);
+                    libraryIsCached = isCachedSharedLibraryValid(dynamicLibraryPath, source);
+                    STORM_LOG_INFO_COND(!libraryIsCached, "Using cached shared library " << dynamicLibraryPath << ".");
+                }
                 
-                // (4) Remove the source code of the shared library we just compiled.
-                boost::filesystem::remove(temporarySourceFile);
+                if (!libraryIsCached) {
+                    // (3) Write the source code to a temporary file and compile it to a shared library.
+                    boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
+                    boost::filesystem::path compiledLibraryPath = compileToSharedLibrary(temporarySourceFile);
+                    STORM_LOG_TRACE("Successfully compiled shared library.");
+                    
+                    // (4) Remove the source code of the shared library we just compiled and put the library into the
+                    // cache (if requested).
+                    boost::filesystem::remove(temporarySourceFile);
+                    if (cacheDirectory) {
+                        storeSharedLibraryInCache(compiledLibraryPath, dynamicLibraryPath, source);
+                    } else {
+                        dynamicLibraryPath = compiledLibraryPath;
+                    }
+                }
                 
                 // (5) Create the builder from the shared library.
                 createBuilder(dynamicLibraryPath);
@@ -553,8 +573,10 @@ namespace storm {
                 auto end = std::chrono::high_resolution_clock::now();
                 STORM_LOG_TRACE("Building model took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
                 
-                // (7) Delete the shared library.
-                boost::filesystem::remove(dynamicLibraryPath);
+                // (7) Delete the shared library unless it is kept in the cache.
+                if (!cacheDirectory) {
+                    boost::filesystem::remove(dynamicLibraryPath);
+                }
                 
                 STORM_LOG_THROW(!error, storm::exceptions::WrongFormatException, "Model building failed. Reason: " << error.get());
                 
@@ -2574,6 +2596,57 @@ namespace storm {
                 return parameters;
             }
                 
+            template <typename ValueType, typename RewardModelType>
+            boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getCachedSharedLibraryPath(std::string const& source) const {
+                // Everything that influences the resulting binary needs to be part of the key.
+                std::size_t hash = 0;
+                boost::hash_combine(hash, source);
+                boost::hash_combine(hash, compiler);
+                boost::hash_combine(hash, compilerFlags);
+                for (std::string const& dir : {stormIncludeDirectory, sparseppIncludeDirectory, boostIncludeDirectory, carlIncludeDirectory, clnIncludeDirectory, gmpIncludeDirectory}) {
+                    boost::hash_combine(hash, dir);
+                }
+                
+                std::stringstream stream;
+                stream << "storm-jit-" << std::hex << hash << DYLIB_EXTENSION;
+                return cacheDirectory.get() / stream.str();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            bool ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::isCachedSharedLibraryValid(boost::filesystem::path const& dynamicLibraryPath, std::string const& source) const {
+                boost::filesystem::path sourcePath = dynamicLibraryPath;
+                sourcePath.replace_extension(".cpp");
+                if (!boost::filesystem::exists(dynamicLibraryPath) || !boost::filesystem::exists(sourcePath)) {
+                    return false;
+                }
+                
+                // Guard against hash collisions by comparing the source the library was compiled from.
+                std::ifstream in(sourcePath.native());
+                std::stringstream cachedSource;
+                cachedSource << in.rdbuf();
+                return cachedSource.str() == source;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            void ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::storeSharedLibraryInCache(boost::filesystem::path const& compiledLibraryPath, boost::filesystem::path const& dynamicLibraryPath, std::string const& source) const {
+                boost::system::error_code errorCode;
+                boost::filesystem::create_directories(cacheDirectory.get(), errorCode);
+                STORM_LOG_THROW(!errorCode, storm::exceptions::InvalidStateException, "Unable to create cache directory " << cacheDirectory.get() << ": " << errorCode.message() << ".");
+                
+                // Copy the library to a unique file in the cache directory first and then rename it, so concurrent
+                // runs never load a partially written library.
+                boost::filesystem::path temporaryLibraryPath = cacheDirectory.get() / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%" + DYLIB_EXTENSION);
+                boost::filesystem::copy_file(compiledLibraryPath, temporaryLibraryPath);
+                boost::filesystem::remove(compiledLibraryPath);
+                boost::filesystem::rename(temporaryLibraryPath, dynamicLibraryPath);
+                
+                boost::filesystem::path sourcePath = dynamicLibraryPath;
+                sourcePath.replace_extension(".cpp");
+                std::ofstream out(sourcePath.native());
+                out << source;
+                out.close();
+            }
+            
             template <typename ValueType, typename RewardModelType>
             void ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::createBuilder(boost::filesystem::path const& dynamicLibraryPath) {
                 jitBuilderCreateFunction = boost::dll::import_alias<typename ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::CreateFunctionType>(dynamicLibraryPath, "create_builder");
@@ -153,6 +153,22 @@ namespace storm {
                  */
                 boost::filesystem::path compileToSharedLibrary(boost::filesystem::path const& sourceFile);
 
+                /*!
+                 * Retrieves the path under which the shared library compiled from the given source is stored in the
+                 * cache directory. The name is derived from a hash of the source and the compiler invocation.
+                 */
+                boost::filesystem::path getCachedSharedLibraryPath(std::string const& source) const;
+                
+                /*!
+                 * Checks whether the cache contains a shared library that was compiled from exactly the given source.
+                 */
+                bool isCachedSharedLibraryValid(boost::filesystem::path const& dynamicLibraryPath, std::string const& source) const;
+                
+                /*!
+                 * Moves the given shared library (compiled from the given source) to the given location in the cache.
+                 */
+                void storeSharedLibraryInCache(boost::filesystem::path const& compiledLibraryPath, boost::filesystem::path const& dynamicLibraryPath, std::string const& source) const;
+                
                 /*!
                  * Loads the given shared library and creates the builder from it.
                  */
@@ -213,6 +229,9 @@ namespace storm {
                 /// The include directory for gmp
                 std::string gmpIncludeDirectory;
                 
+                /// If set, the directory in which compiled shared libraries are kept for reuse.
+                boost::optional<boost::filesystem::path> cacheDirectory;
+                
                 /// A cache that is used by carl.
                 std::shared_ptr<storm::RawPolynomialCache> cache;
             };
@@ -5,6 +5,8 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+
 namespace storm {
     
     LongRunAverageSolverEnvironment::LongRunAverageSolverEnvironment() {
@@ -19,6 +21,7 @@ namespace storm {
             maxIters = lraSettings.getMaximalIterationCount();
         }
         aperiodicFactor = storm::utility::convertNumber<storm::RationalNumber>(lraSettings.getAperiodicFactor());
+        numberOfThreads = lraSettings.getNumberOfThreads();
     }
     
     LongRunAverageSolverEnvironment::~LongRunAverageSolverEnvironment() {
@@ -90,5 +93,14 @@ namespace storm {
     void LongRunAverageSolverEnvironment::setAperiodicFactor(storm::RationalNumber value) {
         aperiodicFactor  = value;
     }
+    
+    uint64_t const& LongRunAverageSolverEnvironment::getNumberOfThreads() const {
+        return numberOfThreads;
+    }
+    
+    void LongRunAverageSolverEnvironment::setNumberOfThreads(uint64_t value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
+        numberOfThreads = value;
+    }
 
 }
@@ -31,6 +31,9 @@ namespace storm {
         
         storm::RationalNumber const& getAperiodicFactor() const;
         void setAperiodicFactor(storm::RationalNumber value);
+        
+        uint64_t const& getNumberOfThreads() const;
+        void setNumberOfThreads(uint64_t value);
 
     private:
         storm::solver::LraMethod detMethod;
@@ -44,6 +47,7 @@ namespace storm {
         boost::optional<uint64_t> maxIters;
         
         storm::RationalNumber aperiodicFactor;
+        uint64_t numberOfThreads;
     };
 }
 
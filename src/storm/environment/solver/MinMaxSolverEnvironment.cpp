@@ -4,6 +4,7 @@
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 namespace storm {
     
@@ -22,6 +23,10 @@ namespace storm {
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
         multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
         symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        modifiedPolicyIterationSteps = minMaxSettings.getModifiedPolicyIterationSteps();
+        prioritizedValueIteration = minMaxSettings.isPrioritizedValueIterationSet();
+        mixedPrecision = minMaxSettings.isMixedPrecisionSet();
+        singlePrecisionThreshold = storm::utility::convertNumber<storm::RationalNumber>(minMaxSettings.getSinglePrecisionThreshold());
     }
 
     MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -81,4 +86,37 @@ namespace storm {
         symmetricUpdates = value;
     }
     
+    uint64_t const& MinMaxSolverEnvironment::getModifiedPolicyIterationSteps() const {
+        return modifiedPolicyIterationSteps;
+    }
+    
+    void MinMaxSolverEnvironment::setModifiedPolicyIterationSteps(uint64_t value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "Modified policy iteration needs to perform at least one evaluation sweep per policy.");
+        modifiedPolicyIterationSteps = value;
+    }
+    
+    bool MinMaxSolverEnvironment::isPrioritizedValueIterationSet() const {
+        return prioritizedValueIteration;
+    }
+    
+    void MinMaxSolverEnvironment::setPrioritizedValueIteration(bool value) {
+        prioritizedValueIteration = value;
+    }
+    
+    bool MinMaxSolverEnvironment::isMixedPrecisionSet() const {
+        return mixedPrecision;
+    }
+    
+    void MinMaxSolverEnvironment::setMixedPrecision(bool value) {
+        mixedPrecision = value;
+    }
+    
+    storm::RationalNumber const& MinMaxSolverEnvironment::getSinglePrecisionThreshold() const {
+        return singlePrecisionThreshold;
+    }
+    
+    void MinMaxSolverEnvironment::setSinglePrecisionThreshold(storm::RationalNumber value) {
+        singlePrecisionThreshold = value;
+    }
+    
 }
@@ -27,6 +27,14 @@ namespace storm {
         void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
+        uint64_t const& getModifiedPolicyIterationSteps() const;
+        void setModifiedPolicyIterationSteps(uint64_t value);
+        bool isPrioritizedValueIterationSet() const;
+        void setPrioritizedValueIteration(bool value);
+        bool isMixedPrecisionSet() const;
+        void setMixedPrecision(bool value);
+        storm::RationalNumber const& getSinglePrecisionThreshold() const;
+        void setSinglePrecisionThreshold(storm::RationalNumber value);
         
     private:
         storm::solver::MinMaxMethod minMaxMethod;
@@ -36,6 +44,10 @@ namespace storm {
         bool considerRelativeTerminationCriterion;
         storm::solver::MultiplicationStyle multiplicationStyle;
         bool symmetricUpdates;
+        uint64_t modifiedPolicyIterationSteps;
+        bool prioritizedValueIteration;
+        bool mixedPrecision;
+        storm::RationalNumber singlePrecisionThreshold;
     };
 }
 
@@ -15,6 +15,8 @@ namespace storm {
         
         underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
         underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+        
+        numberOfThreads = topologicalSettings.getNumberOfThreads();
     }
 
     TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -49,6 +51,15 @@ namespace storm {
         underlyingMinMaxMethod = value;
     }
     
+    uint64_t const& TopologicalSolverEnvironment::getNumberOfThreads() const {
+        return numberOfThreads;
+    }
+    
+    void TopologicalSolverEnvironment::setNumberOfThreads(uint64_t value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
+        numberOfThreads = value;
+    }
+    
 
 
 }
@@ -0,0 +1,15 @@
+#ifndef STORM_EXCEPTIONS_DDMEMORYBUDGETEXCEEDEDEXCEPTION_H_
+#define STORM_EXCEPTIONS_DDMEMORYBUDGETEXCEEDEDEXCEPTION_H_
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/ExceptionMacros.h"
+
+namespace storm {
+    namespace exceptions {
+        
+        STORM_NEW_EXCEPTION(DdMemoryBudgetExceededException)
+        
+    } // namespace exceptions
+} // namespace storm
+
+#endif /* STORM_EXCEPTIONS_DDMEMORYBUDGETEXCEEDEDEXCEPTION_H_ */
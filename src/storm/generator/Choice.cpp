@@ -168,6 +168,16 @@ namespace storm {
             distribution.reserve(size);
         }
         
+        template<typename ValueType, typename StateType>
+        void Choice<ValueType, StateType>::remapStates(std::vector<StateType> const& remapping) {
+            storm::storage::Distribution<ValueType, StateType> remappedDistribution;
+            remappedDistribution.reserve(distribution.size());
+            for (auto const& stateProbabilityPair : distribution) {
+                remappedDistribution.addProbability(remapping[stateProbabilityPair.first], stateProbabilityPair.second);
+            }
+            distribution = std::move(remappedDistribution);
+        }
+        
         template<typename ValueType, typename StateType>
         std::ostream& operator<<(std::ostream& out, Choice<ValueType, StateType> const& choice) {
             out << "<";
@@ -155,6 +155,13 @@ namespace storm {
              */
             void reserve(std::size_t const& size);
             
+            /*!
+             * Replaces every state in the distribution of this choice by the state it is mapped to.
+             *
+             * @param remapping A vector mapping the states of the distribution to their new indices.
+             */
+            void remapStates(std::vector<StateType> const& remapping);
+            
         private:
             // A flag indicating whether this choice is Markovian or not.
             bool markovian;
@@ -0,0 +1,268 @@
+#include "storm/generator/CompiledStateExpression.h"
+
+#include <cmath>
+#include <limits>
+#include <map>
+
+#include "storm/generator/VariableInformation.h"
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        bool CompiledStateExpression::evaluateAsBool(CompressedState const& state) const {
+            return evaluate(state) == 1.0;
+        }
+
+        int_fast64_t CompiledStateExpression::evaluateAsInt(CompressedState const& state) const {
+            return static_cast<int_fast64_t>(evaluate(state));
+        }
+
+        double CompiledStateExpression::evaluateAsDouble(CompressedState const& state) const {
+            return evaluate(state);
+        }
+
+        uint64_t CompiledStateExpression::getNumberOfInstructions() const {
+            return instructions.size();
+        }
+
+        double CompiledStateExpression::evaluate(CompressedState const& state) const {
+            double* r = registers.data();
+            uint64_t pc = 0;
+            uint64_t const end = instructions.size();
+            while (pc < end) {
+                Instruction const& instruction = instructions[pc];
+                ++pc;
+                switch (instruction.opcode) {
+                    case OpCode::LoadBoolean: r[instruction.target] = state.get(instruction.first) ? 1.0 : 0.0; break;
+                    case OpCode::LoadInteger: r[instruction.target] = static_cast<double>(static_cast<int_fast64_t>(state.getAsInt(instruction.first, instruction.bitWidth)) + static_cast<int_fast64_t>(r[instruction.second])); break;
+                    case OpCode::Not: r[instruction.target] = r[instruction.first] == 0.0 ? 1.0 : 0.0; break;
+                    case OpCode::And: r[instruction.target] = (r[instruction.first] != 0.0 && r[instruction.second] != 0.0) ? 1.0 : 0.0; break;
+                    case OpCode::Or: r[instruction.target] = (r[instruction.first] != 0.0 || r[instruction.second] != 0.0) ? 1.0 : 0.0; break;
+                    case OpCode::Xor: r[instruction.target] = ((r[instruction.first] != 0.0) != (r[instruction.second] != 0.0)) ? 1.0 : 0.0; break;
+                    case OpCode::Implies: r[instruction.target] = (r[instruction.first] == 0.0 || r[instruction.second] != 0.0) ? 1.0 : 0.0; break;
+                    case OpCode::Iff: r[instruction.target] = r[instruction.first] == r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Plus: r[instruction.target] = r[instruction.first] + r[instruction.second]; break;
+                    case OpCode::Minus: r[instruction.target] = r[instruction.first] - r[instruction.second]; break;
+                    case OpCode::Times: r[instruction.target] = r[instruction.first] * r[instruction.second]; break;
+                    case OpCode::Divide: r[instruction.target] = r[instruction.first] / r[instruction.second]; break;
+                    case OpCode::Min: r[instruction.target] = std::min(r[instruction.first], r[instruction.second]); break;
+                    case OpCode::Max: r[instruction.target] = std::max(r[instruction.first], r[instruction.second]); break;
+                    case OpCode::Power: r[instruction.target] = std::pow(r[instruction.first], r[instruction.second]); break;
+                    case OpCode::Modulo: r[instruction.target] = std::fmod(r[instruction.first], r[instruction.second]); break;
+                    case OpCode::Negate: r[instruction.target] = -r[instruction.first]; break;
+                    case OpCode::Floor: r[instruction.target] = std::floor(r[instruction.first]); break;
+                    case OpCode::Ceil: r[instruction.target] = std::ceil(r[instruction.first]); break;
+                    case OpCode::Equal: r[instruction.target] = r[instruction.first] == r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::NotEqual: r[instruction.target] = r[instruction.first] != r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Less: r[instruction.target] = r[instruction.first] < r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::LessOrEqual: r[instruction.target] = r[instruction.first] <= r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Greater: r[instruction.target] = r[instruction.first] > r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::GreaterOrEqual: r[instruction.target] = r[instruction.first] >= r[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Copy: r[instruction.target] = r[instruction.first]; break;
+                    case OpCode::JumpIfZero: if (r[instruction.first] == 0.0) { pc = instruction.second; } break;
+                    case OpCode::Jump: pc = instruction.first; break;
+                }
+            }
+            return r[resultRegister];
+        }
+
+        class StateExpressionCompilerVisitor : public storm::expressions::ExpressionVisitor {
+        public:
+            typedef CompiledStateExpression::OpCode OpCode;
+            typedef CompiledStateExpression::Instruction Instruction;
+
+            StateExpressionCompilerVisitor(std::unordered_map<storm::expressions::Variable, StateExpressionCompiler::VariableLayout> const& variableToLayout, CompiledStateExpression& result) : variableToLayout(variableToLayout), result(result), supported(true) {
+                // Intentionally left empty.
+            }
+
+            uint32_t compile(storm::expressions::BaseExpression const& expression) {
+                return boost::any_cast<uint32_t>(expression.accept(*this, boost::none));
+            }
+
+            bool isSupported() const {
+                return supported;
+            }
+
+            virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const&) override {
+                uint32_t condition = compile(*expression.getCondition());
+                uint32_t target = newRegister();
+
+                // Only the selected branch is evaluated, so we jump over the other one.
+                uint64_t jumpToElse = result.instructions.size();
+                result.instructions.push_back(Instruction{OpCode::JumpIfZero, 0, 0, condition, 0});
+                emit(OpCode::Copy, target, compile(*expression.getThenExpression()));
+                uint64_t jumpToEnd = result.instructions.size();
+                result.instructions.push_back(Instruction{OpCode::Jump, 0, 0, 0, 0});
+                result.instructions[jumpToElse].second = static_cast<uint32_t>(result.instructions.size());
+                emit(OpCode::Copy, target, compile(*expression.getElseExpression()));
+                result.instructions[jumpToEnd].first = static_cast<uint32_t>(result.instructions.size());
+                return target;
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const&) override {
+                uint32_t first = compile(*expression.getFirstOperand());
+                uint32_t second = compile(*expression.getSecondOperand());
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And: return emit(OpCode::And, newRegister(), first, second);
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or: return emit(OpCode::Or, newRegister(), first, second);
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor: return emit(OpCode::Xor, newRegister(), first, second);
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies: return emit(OpCode::Implies, newRegister(), first, second);
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff: return emit(OpCode::Iff, newRegister(), first, second);
+                }
+                return unsupported();
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const&) override {
+                uint32_t first = compile(*expression.getFirstOperand());
+                uint32_t second = compile(*expression.getSecondOperand());
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus: return emit(OpCode::Plus, newRegister(), first, second);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus: return emit(OpCode::Minus, newRegister(), first, second);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times: return emit(OpCode::Times, newRegister(), first, second);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide: return emit(OpCode::Divide, newRegister(), first, second);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min: return emit(OpCode::Min, newRegister(), first, second);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max: return emit(OpCode::Max, newRegister(), first, second);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power: return emit(OpCode::Power, newRegister(), first, second);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Modulo: return emit(OpCode::Modulo, newRegister(), first, second);
+                }
+                return unsupported();
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const&) override {
+                uint32_t first = compile(*expression.getFirstOperand());
+                uint32_t second = compile(*expression.getSecondOperand());
+                switch (expression.getRelationType()) {
+                    case storm::expressions::BinaryRelationExpression::RelationType::Equal: return emit(OpCode::Equal, newRegister(), first, second);
+                    case storm::expressions::BinaryRelationExpression::RelationType::NotEqual: return emit(OpCode::NotEqual, newRegister(), first, second);
+                    case storm::expressions::BinaryRelationExpression::RelationType::Less: return emit(OpCode::Less, newRegister(), first, second);
+                    case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual: return emit(OpCode::LessOrEqual, newRegister(), first, second);
+                    case storm::expressions::BinaryRelationExpression::RelationType::Greater: return emit(OpCode::Greater, newRegister(), first, second);
+                    case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual: return emit(OpCode::GreaterOrEqual, newRegister(), first, second);
+                }
+                return unsupported();
+            }
+
+            virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+                auto layoutIt = variableToLayout.find(expression.getVariable());
+                if (layoutIt == variableToLayout.end()) {
+                    // The variable is not part of the state, so we cannot read it.
+                    return unsupported();
+                }
+
+                StateExpressionCompiler::VariableLayout const& layout = layoutIt->second;
+                if (layout.isBoolean) {
+                    return emit(OpCode::LoadBoolean, newRegister(), layout.bitOffset);
+                } else if (layout.bitWidth == 0) {
+                    return constant(static_cast<double>(layout.lowerBound));
+                } else {
+                    uint32_t target = emit(OpCode::LoadInteger, newRegister(), layout.bitOffset, constant(static_cast<double>(layout.lowerBound)));
+                    result.instructions.back().bitWidth = layout.bitWidth;
+                    return target;
+                }
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const&) override {
+                uint32_t operand = compile(*expression.getOperand());
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::UnaryBooleanFunctionExpression::OperatorType::Not: return emit(OpCode::Not, newRegister(), operand);
+                }
+                return unsupported();
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const&) override {
+                uint32_t operand = compile(*expression.getOperand());
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus: return emit(OpCode::Negate, newRegister(), operand);
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor: return emit(OpCode::Floor, newRegister(), operand);
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil: return emit(OpCode::Ceil, newRegister(), operand);
+                }
+                return unsupported();
+            }
+
+            virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+                return constant(expression.getValue() ? 1.0 : 0.0);
+            }
+
+            virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+                return constant(static_cast<double>(expression.getValue()));
+            }
+
+            virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+                return constant(expression.getValueAsDouble());
+            }
+
+        private:
+            uint32_t newRegister() {
+                result.registers.push_back(0.0);
+                return static_cast<uint32_t>(result.registers.size() - 1);
+            }
+
+            uint32_t constant(double value) {
+                auto constantIt = constantToRegister.find(value);
+                if (constantIt != constantToRegister.end()) {
+                    return constantIt->second;
+                }
+                uint32_t target = newRegister();
+                result.registers[target] = value;
+                constantToRegister[value] = target;
+                return target;
+            }
+
+            uint32_t emit(OpCode opcode, uint32_t target, uint32_t first, uint32_t second = 0) {
+                result.instructions.push_back(Instruction{opcode, 0, target, first, second});
+                return target;
+            }
+
+            uint32_t unsupported() {
+                supported = false;
+                return constant(0.0);
+            }
+
+            std::unordered_map<storm::expressions::Variable, StateExpressionCompiler::VariableLayout> const& variableToLayout;
+            CompiledStateExpression& result;
+            std::map<double, uint32_t> constantToRegister;
+            bool supported;
+        };
+
+        StateExpressionCompiler::StateExpressionCompiler(VariableInformation const& variableInformation) {
+            uint64_t const maximalBitOffset = std::numeric_limits<uint32_t>::max();
+            for (auto const& locationVariable : variableInformation.locationVariables) {
+                if (locationVariable.bitOffset < maximalBitOffset) {
+                    variableToLayout[locationVariable.variable] = VariableLayout{static_cast<uint32_t>(locationVariable.bitOffset), static_cast<uint8_t>(locationVariable.bitWidth), false, 0};
+                }
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                if (booleanVariable.bitOffset < maximalBitOffset) {
+                    variableToLayout[booleanVariable.variable] = VariableLayout{static_cast<uint32_t>(booleanVariable.bitOffset), 1, true, 0};
+                }
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                if (integerVariable.bitOffset < maximalBitOffset) {
+                    variableToLayout[integerVariable.variable] = VariableLayout{static_cast<uint32_t>(integerVariable.bitOffset), static_cast<uint8_t>(integerVariable.bitWidth), false, integerVariable.lowerBound};
+                }
+            }
+        }
+
+        boost::optional<CompiledStateExpression> StateExpressionCompiler::compile(storm::expressions::Expression const& expression) const {
+            if (!expression.isInitialized()) {
+                return boost::none;
+            }
+
+            CompiledStateExpression result;
+            StateExpressionCompilerVisitor visitor(variableToLayout, result);
+            result.resultRegister = visitor.compile(expression.getBaseExpression());
+            if (!visitor.isSupported()) {
+                return boost::none;
+            }
+            STORM_LOG_TRACE("Compiled expression " << expression << " to " << result.getNumberOfInstructions() << " instructions.");
+            return result;
+        }
+
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace expressions {
+        class Expression;
+    }
+
+    namespace generator {
+
+        struct VariableInformation;
+        class StateExpressionCompiler;
+        class StateExpressionCompilerVisitor;
+
+        /*!
+         * An expression that was lowered to a flat sequence of instructions operating on registers. Variables are read
+         * directly from the bit layout of compressed states, so evaluating the expression neither requires unpacking
+         * the state into an evaluator nor walking the expression tree.
+         *
+         * The semantics coincide with the (exprtk-based) expression evaluators: all values are represented as doubles,
+         * booleans are encoded as zero and one and integer results are obtained by truncation.
+         */
+        class CompiledStateExpression {
+        public:
+            /*!
+             * Evaluates the expression in the given state.
+             */
+            bool evaluateAsBool(CompressedState const& state) const;
+            int_fast64_t evaluateAsInt(CompressedState const& state) const;
+            double evaluateAsDouble(CompressedState const& state) const;
+
+            /*!
+             * Retrieves the number of instructions of the compiled program.
+             */
+            uint64_t getNumberOfInstructions() const;
+
+        private:
+            friend class StateExpressionCompiler;
+            friend class StateExpressionCompilerVisitor;
+
+            enum class OpCode : uint8_t {
+                LoadBoolean, LoadInteger, Not, And, Or, Xor, Implies, Iff,
+                Plus, Minus, Times, Divide, Min, Max, Power, Modulo, Negate, Floor, Ceil,
+                Equal, NotEqual, Less, LessOrEqual, Greater, GreaterOrEqual,
+                Copy, JumpIfZero, Jump
+            };
+
+            /*!
+             * A single instruction. Operands are register indices except for loads (where the first operand is the bit
+             * offset and the second one the register holding the lower bound of the variable) and jumps (where the
+             * operand denotes the index of the next instruction).
+             */
+            struct Instruction {
+                OpCode opcode;
+                uint8_t bitWidth;
+                uint32_t target;
+                uint32_t first;
+                uint32_t second;
+            };
+
+            CompiledStateExpression() = default;
+
+            double evaluate(CompressedState const& state) const;
+
+            // The instructions of the program.
+            std::vector<Instruction> instructions;
+
+            // The registers. Registers that hold constants are initialized during compilation and never overwritten.
+            mutable std::vector<double> registers;
+
+            // The register that holds the result after the evaluation.
+            uint32_t resultRegister;
+        };
+
+        /*!
+         * Compiles expressions over the variables of a state layout into compiled state expressions.
+         */
+        class StateExpressionCompiler {
+        public:
+            StateExpressionCompiler(VariableInformation const& variableInformation);
+
+            /*!
+             * Compiles the given expression. If the expression refers to variables that are not stored in the state
+             * (e.g. transient variables), boost::none is returned and the expression needs to be evaluated otherwise.
+             */
+            boost::optional<CompiledStateExpression> compile(storm::expressions::Expression const& expression) const;
+
+        private:
+            friend class StateExpressionCompilerVisitor;
+            
+            struct VariableLayout {
+                uint32_t bitOffset;
+                uint8_t bitWidth;
+                bool isBoolean;
+                int_fast64_t lowerBound;
+            };
+
+            // The layout of all variables that are stored in the state.
+            std::unordered_map<storm::expressions::Variable, VariableLayout> variableToLayout;
+        };
+
+    }
+}
@@ -90,6 +90,11 @@ namespace storm {
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(this->model.getManager());
             this->transientVariableInformation.setDefaultValuesInEvaluator(*this->evaluator);
             
+            // Compile the guards, as these are evaluated most frequently.
+            compileGuards();
+            STORM_LOG_WARN_COND(!this->options.isPartialOrderReductionSet(), "Partial-order reduction is only supported for PRISM programs and is not applied.");
+            STORM_LOG_WARN_COND(!this->options.isSymmetryReductionSet(), "Symmetry reduction is only supported for PRISM programs and is not applied.");
+            STORM_LOG_WARN_COND(!this->options.isDeferStateRewardsSet(), "Computing the state rewards after the exploration is only supported for PRISM programs. They are computed during the exploration instead.");
             
             // Build the information structs for the reward models.
             buildRewardModelInformation();
@@ -680,7 +685,8 @@ namespace storm {
                     int64_t assignmentLevel = edge.getLowestAssignmentLevel(); // Might be the largest possible integer, if there is no assignment
                     int64_t const& highestLevel = edge.getHighestAssignmentLevel();
                     bool hasTransientAssignments = destination.hasTransientAssignment();
-                    CompressedState newState = state;
+                    CompressedState& newState = this->getScratchState();
+                    newState = state;
                     applyUpdate(newState, destination, this->variableInformation.locationVariables[automatonIndex], assignmentLevel, *this->evaluator);
                     if (hasTransientAssignments) {
                         STORM_LOG_ASSERT(this->options.isScaleAndLiftTransitionRewardsSet(), "Transition rewards are not supported and scaling to action rewards is disabled.");
@@ -788,7 +794,8 @@ namespace storm {
                 destinations.clear();
                 locationVars.clear();
                 transientVariableValuation.clear();
-                CompressedState successorState = state;
+                CompressedState& successorState = this->getScratchState();
+                successorState = state;
                 ValueType successorProbability = storm::utility::one<ValueType>();
 
                 uint64_t destinationIndex = destinationId;
@@ -952,7 +959,7 @@ namespace storm {
                                     continue;
                                 }
                             }
-                            if (!this->evaluator->asBool(indexAndEdge.second->getGuard())) {
+                            if (!this->isEnabled(*indexAndEdge.second)) {
                                 continue;
                             }
                         
@@ -1001,7 +1008,7 @@ namespace storm {
                                     }
                                 }
                             
-                                if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                                if (!this->isEnabled(*indexAndEdgeIt->second)) {
                                     continue;
                                 }
                             
@@ -1044,7 +1051,7 @@ namespace storm {
                                     }
                                 }
                                 
-                                if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                                if (!this->isEnabled(*indexAndEdgeIt->second)) {
                                     continue;
                                 }
                                 // If we reach this point, the edge is considered enabled.
@@ -1159,6 +1166,31 @@ namespace storm {
             }
         }
         
+        template<typename ValueType, typename StateType>
+        void JaniNextStateGenerator<ValueType, StateType>::compileGuards() {
+            StateExpressionCompiler compiler(this->variableInformation);
+            uint64_t numberOfEdges = 0;
+            for (auto const& automaton : this->parallelAutomata) {
+                for (auto const& edge : automaton.get().getEdges()) {
+                    boost::optional<CompiledStateExpression> compiledGuard = compiler.compile(edge.getGuard());
+                    if (compiledGuard) {
+                        compiledGuards.emplace(&edge, std::move(compiledGuard.get()));
+                    }
+                    ++numberOfEdges;
+                }
+            }
+            STORM_LOG_DEBUG("Compiled " << compiledGuards.size() << " of " << numberOfEdges << " guards.");
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool JaniNextStateGenerator<ValueType, StateType>::isEnabled(storm::jani::Edge const& edge) const {
+            auto compiledGuardIt = compiledGuards.find(&edge);
+            if (compiledGuardIt != compiledGuards.end()) {
+                return compiledGuardIt->second.evaluateAsBool(*this->state);
+            }
+            return this->evaluator->asBool(edge.getGuard());
+        }
+        
         template<typename ValueType, typename StateType>
         void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformation() {
             // Create synchronizing edges information.
@@ -2,6 +2,7 @@
 
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/TransientVariableInformation.h"
+#include "storm/generator/CompiledStateExpression.h"
 
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/ArrayEliminator.h"
@@ -172,6 +173,16 @@ namespace storm {
              */
             void createSynchronizationInformation();
             
+            /*!
+             * Compiles the guards of all edges against the layout of the states.
+             */
+            void compileGuards();
+            
+            /*!
+             * Checks whether the guard of the given edge is satisfied in the currently loaded state.
+             */
+            bool isEnabled(storm::jani::Edge const& edge) const;
+            
             /*!
              * Checks the underlying model for validity for this next-state generator.
              */
@@ -186,6 +197,9 @@ namespace storm {
             /// The vector storing the edges that need to be explored (synchronously or asynchronously).
             std::vector<OutputAndEdges> edges;
             
+            /// The compiled guards of the edges. Edges whose guard could not be compiled are not contained.
+            std::unordered_map<storm::jani::Edge const*, CompiledStateExpression> compiledGuards;
+            
             /// The names and defining expressions of reward models that need to be considered.
             std::vector<std::pair<std::string, storm::expressions::Expression>> rewardExpressions;
             
@@ -13,6 +13,7 @@
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace generator {
@@ -51,13 +52,13 @@ namespace storm {
         storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, StateType>::initializeStateValuationsBuilder() const {
             storm::storage::sparse::StateValuationsBuilder result;
             for (auto const& v : variableInformation.locationVariables) {
-                result.addVariable(v.variable);
+                result.addVariable(v.variable, 0, static_cast<int64_t>(v.highestValue));
             }
             for (auto const& v : variableInformation.booleanVariables) {
                 result.addVariable(v.variable);
             }
             for (auto const& v : variableInformation.integerVariables) {
-                result.addVariable(v.variable);
+                result.addVariable(v.variable, v.lowerBound, v.upperBound);
             }
             return result;
         }
@@ -84,6 +85,14 @@ namespace storm {
             return variableInformation;
         }
         
+        template<typename ValueType, typename StateType>
+        CompressedState& NextStateGenerator<ValueType, StateType>::getScratchState(uint64_t index) {
+            while (scratchStates.size() <= index) {
+                scratchStates.emplace_back(this->getStateSize());
+            }
+            return scratchStates[index];
+        }
+        
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::addStateValuation(storm::storage::sparse::state_type const& currentStateIndex, storm::storage::sparse::StateValuationsBuilder& valuationsBuilder) const {
             std::vector<bool> booleanValues;
@@ -112,17 +121,16 @@ namespace storm {
                 result.addLabel(label.first);
             }
             
-            auto const& states = stateStorage.stateToId;
-            for (auto const& stateIndexPair : states) {
-                unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+            stateStorage.forEachState([&] (storm::storage::BitVector const& state, StateType const& stateIndex) {
+                unpackStateIntoEvaluator(state, variableInformation, *this->evaluator);
                 
                 for (auto const& label : labelsAndExpressions) {
                     // Add label to state, if the corresponding expression is true.
                     if (evaluator->asBool(label.second)) {
-                        result.addLabelToState(label.first, stateIndexPair.second);
+                        result.addLabelToState(label.first, stateIndex);
                     }
                 }
-            }
+            });
             
             if (!result.containsLabel("init")) {
                 // Also label the initial state with the special label "init".
@@ -146,10 +154,13 @@ namespace storm {
                 }
             }
 
-            if (this->options.isAddOutOfBoundsStateSet() && stateStorage.stateToId.contains(outOfBoundsState)) {
-                STORM_LOG_THROW(!result.containsLabel("out_of_bounds"),storm::exceptions::WrongFormatException, "Label 'out_of_bounds' is reserved when adding out of bounds states.");
-                result.addLabel("out_of_bounds");
-                result.addLabelToState("out_of_bounds", stateStorage.stateToId.getValue(outOfBoundsState));
+            if (this->options.isAddOutOfBoundsStateSet()) {
+                boost::optional<StateType> outOfBoundsStateIndex = stateStorage.getStateIndex(outOfBoundsState);
+                if (outOfBoundsStateIndex) {
+                    STORM_LOG_THROW(!result.containsLabel("out_of_bounds"),storm::exceptions::WrongFormatException, "Label 'out_of_bounds' is reserved when adding out of bounds states.");
+                    result.addLabel("out_of_bounds");
+                    result.addLabelToState("out_of_bounds", outOfBoundsStateIndex.get());
+                }
             }
             
             return result;
@@ -224,6 +235,21 @@ namespace storm {
             // Nothing to be done.
         }
 
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> NextStateGenerator<ValueType, StateType>::clone() const {
+            return nullptr;
+        }
+
+        template<typename ValueType, typename StateType>
+        bool NextStateGenerator<ValueType, StateType>::isStateRewardEvaluationDeferred() const {
+            return false;
+        }
+
+        template<typename ValueType, typename StateType>
+        ValueType NextStateGenerator<ValueType, StateType>::evaluateStateReward(uint64_t) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The generator does not support evaluating state rewards separately.");
+        }
+
         template class NextStateGenerator<double>;
 
 #ifdef STORM_HAVE_CARL
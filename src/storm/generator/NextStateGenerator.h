@@ -2,6 +2,7 @@
 #define STORM_GENERATOR_NEXTSTATEGENERATOR_H_
 
 #include <vector>
+#include <deque>
 #include <cstdint>
 
 #include <boost/variant.hpp>
@@ -87,6 +88,30 @@ namespace storm {
              */
             void remapStateIds(std::function<StateType(StateType const&)> const& remapping);
             
+            /*!
+             * Creates a generator for the same model and options that does not share any mutable data with this
+             * generator, such that both can expand states concurrently. The generator is only meant to expand states,
+             * i.e. it does not know about the initial states or the overlapping guards found by this generator.
+             *
+             * @return The new generator or nullptr if the generator cannot be copied.
+             */
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const;
+            
+            /*!
+             * Retrieves whether the generator leaves out the state rewards when expanding states, which means that the
+             * behaviors returned by expand only carry zero state rewards and the actual values have to be obtained by
+             * evaluateStateReward.
+             */
+            virtual bool isStateRewardEvaluationDeferred() const;
+            
+            /*!
+             * Evaluates the state reward of the given reward model in the currently loaded state.
+             *
+             * @param rewardModelIndex The index of the reward model.
+             * @return The state reward.
+             */
+            virtual ValueType evaluateStateReward(uint64_t rewardModelIndex) const;
+            
         protected:
             /*!
              * Creates the state labeling for the given states using the provided labels and expressions.
@@ -97,6 +122,15 @@ namespace storm {
 
             void postprocess(StateBehavior<ValueType, StateType>& result);
             
+            /*!
+             * Retrieves a state that can be used to construct successor states. Reusing these states avoids allocating
+             * memory for every successor. References to a scratch state remain valid when scratch states with other
+             * indices are requested.
+             *
+             * @param index The index of the scratch state (e.g. the depth in a recursive construction).
+             */
+            CompressedState& getScratchState(uint64_t index = 0);
+            
             /// The options to be used for next-state generation.
             NextStateGeneratorOptions options;
             
@@ -126,6 +160,9 @@ namespace storm {
             mutable std::unordered_map<storm::storage::BitVector, uint32_t> observabilityMap;
             /// A state that encodes the outOfBoundsState
             CompressedState outOfBoundsState;
+            
+            /// The states used to construct successor states.
+            std::deque<CompressedState> scratchStates;
 
             /// A map that stores the indices of states with overlapping guards.
             boost::optional<std::vector<uint64_t>> overlappingGuardStates;
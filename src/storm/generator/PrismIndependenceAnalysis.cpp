@@ -0,0 +1,98 @@
+#include "storm/generator/PrismIndependenceAnalysis.h"
+
+#include "storm/storage/prism/Program.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            struct ModuleAccesses {
+                // The variables read by any command of the module.
+                std::set<storm::expressions::Variable> readVariables;
+
+                // The variables written by any command of the module.
+                std::set<storm::expressions::Variable> writtenVariables;
+
+                // The variables written by the unlabeled commands of the module.
+                std::set<storm::expressions::Variable> locallyWrittenVariables;
+
+                // Whether an unlabeled command of the module carries a visible action.
+                bool hasVisibleLocalAction = false;
+
+                // Whether the module has unlabeled commands.
+                bool hasLocalCommands = false;
+            };
+
+            bool intersects(std::set<storm::expressions::Variable> const& first, std::set<storm::expressions::Variable> const& second) {
+                auto firstIt = first.begin();
+                auto secondIt = second.begin();
+                while (firstIt != first.end() && secondIt != second.end()) {
+                    if (*firstIt < *secondIt) {
+                        ++firstIt;
+                    } else if (*secondIt < *firstIt) {
+                        ++secondIt;
+                    } else {
+                        return true;
+                    }
+                }
+                return false;
+            }
+        }
+
+        PrismIndependenceAnalysis::PrismIndependenceAnalysis(storm::prism::Program const& program, std::set<storm::expressions::Variable> const& visibleVariables, std::set<uint64_t> const& visibleActionIndices) {
+            std::vector<ModuleAccesses> accesses(program.getNumberOfModules());
+            for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                ModuleAccesses& moduleAccesses = accesses[moduleIndex];
+                for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+                    std::set<storm::expressions::Variable> guardVariables = command.getGuardExpression().getVariables();
+                    moduleAccesses.readVariables.insert(guardVariables.begin(), guardVariables.end());
+                    if (!command.isLabeled()) {
+                        moduleAccesses.hasLocalCommands = true;
+                        moduleAccesses.hasVisibleLocalAction |= visibleActionIndices.count(command.getActionIndex()) > 0;
+                    }
+
+                    for (auto const& update : command.getUpdates()) {
+                        std::set<storm::expressions::Variable> likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                        moduleAccesses.readVariables.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                        for (auto const& assignment : update.getAssignments()) {
+                            std::set<storm::expressions::Variable> assignmentVariables = assignment.getExpression().getVariables();
+                            moduleAccesses.readVariables.insert(assignmentVariables.begin(), assignmentVariables.end());
+                            moduleAccesses.writtenVariables.insert(assignment.getVariable());
+                            if (!command.isLabeled()) {
+                                moduleAccesses.locallyWrittenVariables.insert(assignment.getVariable());
+                            }
+                        }
+                    }
+                }
+            }
+
+            for (uint64_t moduleIndex = 0; moduleIndex < accesses.size(); ++moduleIndex) {
+                ModuleAccesses const& moduleAccesses = accesses[moduleIndex];
+                if (!moduleAccesses.hasLocalCommands || moduleAccesses.hasVisibleLocalAction || intersects(moduleAccesses.locallyWrittenVariables, visibleVariables)) {
+                    continue;
+                }
+
+                bool independent = true;
+                for (uint64_t otherModuleIndex = 0; independent && otherModuleIndex < accesses.size(); ++otherModuleIndex) {
+                    if (otherModuleIndex == moduleIndex) {
+                        continue;
+                    }
+                    ModuleAccesses const& otherAccesses = accesses[otherModuleIndex];
+                    independent = !intersects(moduleAccesses.locallyWrittenVariables, otherAccesses.readVariables) && !intersects(moduleAccesses.locallyWrittenVariables, otherAccesses.writtenVariables) && !intersects(moduleAccesses.readVariables, otherAccesses.writtenVariables);
+                }
+                if (independent) {
+                    independentModuleIndices.push_back(moduleIndex);
+                }
+            }
+
+            STORM_LOG_DEBUG("Partial-order reduction may use ample sets of " << independentModuleIndices.size() << " out of " << accesses.size() << " modules.");
+        }
+
+        std::vector<uint64_t> const& PrismIndependenceAnalysis::getIndependentModuleIndices() const {
+            return independentModuleIndices;
+        }
+
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+
+    namespace generator {
+
+        /*!
+         * A static analysis of the read and write sets of the commands of a PRISM program that determines which
+         * modules may provide ample sets for partial-order reduction.
+         *
+         * A module qualifies if
+         * (1) its unlabeled commands only write variables that no other module reads or writes,
+         * (2) its commands (including the labeled ones) only read variables that no other module writes,
+         * (3) its unlabeled commands do not write visible variables and do not carry visible actions.
+         * Under these conditions, an unlabeled command of the module that is the only enabled command of the module
+         * is independent of all commands of other modules and stays enabled until it is taken. Moreover, commands of
+         * the module that are disabled stay disabled until a command of the module is taken.
+         */
+        class PrismIndependenceAnalysis {
+        public:
+            /*!
+             * Performs the analysis for the given program.
+             *
+             * @param program The program to analyze.
+             * @param visibleVariables The variables that occur in labels, reward structures or other expressions whose
+             * values must be preserved by the reduction.
+             * @param visibleActionIndices The indices of the actions that carry rewards.
+             */
+            PrismIndependenceAnalysis(storm::prism::Program const& program, std::set<storm::expressions::Variable> const& visibleVariables, std::set<uint64_t> const& visibleActionIndices);
+
+            /*!
+             * Retrieves the indices of the modules whose unlabeled commands may form ample sets.
+             */
+            std::vector<uint64_t> const& getIndependentModuleIndices() const;
+
+        private:
+            // The indices of the modules whose unlabeled commands may form ample sets.
+            std::vector<uint64_t> independentModuleIndices;
+        };
+
+    }
+}
@@ -0,0 +1,253 @@
+#include "storm/generator/PrismModuleSymmetry.h"
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/solver/SmtSolver.h"
+#include "storm/utility/solver.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            std::set<storm::expressions::Variable> getReferencedVariables(storm::prism::Module const& module) {
+                std::set<storm::expressions::Variable> result;
+                auto addVariables = [&result] (storm::expressions::Expression const& expression) {
+                    std::set<storm::expressions::Variable> variables = expression.getVariables();
+                    result.insert(variables.begin(), variables.end());
+                };
+                for (auto const& command : module.getCommands()) {
+                    addVariables(command.getGuardExpression());
+                    for (auto const& update : command.getUpdates()) {
+                        addVariables(update.getLikelihoodExpression());
+                        for (auto const& assignment : update.getAssignments()) {
+                            addVariables(assignment.getExpression());
+                            result.insert(assignment.getVariable());
+                        }
+                    }
+                }
+                return result;
+            }
+        }
+
+        PrismModuleSymmetry::PrismModuleSymmetry(storm::prism::Program const& originalProgram, storm::prism::Program const& program, VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& visibleExpressions) {
+            STORM_LOG_ASSERT(originalProgram.getNumberOfModules() == program.getNumberOfModules(), "Mismatching number of modules.");
+
+            // Determine where the variables are stored.
+            std::map<storm::expressions::Variable, std::pair<uint64_t, uint64_t>> variableToBits;
+            std::map<storm::expressions::Variable, int64_t> variableToLowerBound;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableToBits[booleanVariable.variable] = std::make_pair(booleanVariable.bitOffset, 1);
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                variableToBits[integerVariable.variable] = std::make_pair(integerVariable.bitOffset, integerVariable.bitWidth);
+                variableToLowerBound[integerVariable.variable] = integerVariable.lowerBound;
+            }
+
+            std::vector<std::set<storm::expressions::Variable>> referencedVariables;
+            for (auto const& module : program.getModules()) {
+                referencedVariables.push_back(getReferencedVariables(module));
+            }
+
+            std::unique_ptr<storm::solver::SmtSolver> solver;
+            for (uint64_t baseIndex = 0; baseIndex < originalProgram.getNumberOfModules(); ++baseIndex) {
+                storm::prism::Module const& baseModule = originalProgram.getModule(baseIndex);
+                if (baseModule.isRenamedFromModule() || !baseModule.getClockVariables().empty()) {
+                    continue;
+                }
+
+                std::vector<storm::expressions::Variable> baseVariables;
+                for (auto const& booleanVariable : baseModule.getBooleanVariables()) {
+                    baseVariables.push_back(booleanVariable.getExpressionVariable());
+                }
+                for (auto const& integerVariable : baseModule.getIntegerVariables()) {
+                    baseVariables.push_back(integerVariable.getExpressionVariable());
+                }
+                if (baseVariables.empty()) {
+                    continue;
+                }
+
+                // Collect the modules that were obtained from the base module by renaming exactly its local variables.
+                std::vector<uint64_t> moduleIndices = {baseIndex};
+                std::vector<std::vector<storm::expressions::Variable>> moduleVariables = {baseVariables};
+                for (uint64_t moduleIndex = 0; moduleIndex < originalProgram.getNumberOfModules(); ++moduleIndex) {
+                    storm::prism::Module const& module = originalProgram.getModule(moduleIndex);
+                    if (!module.isRenamedFromModule() || module.getBaseModule() != baseModule.getName()) {
+                        continue;
+                    }
+                    std::map<std::string, std::string> const& renaming = module.getRenaming();
+                    bool onlyLocalVariablesRenamed = renaming.size() == baseVariables.size();
+                    std::vector<storm::expressions::Variable> renamedVariables;
+                    for (auto const& variable : baseVariables) {
+                        auto renamingIt = renaming.find(variable.getName());
+                        if (!onlyLocalVariablesRenamed || renamingIt == renaming.end() || !originalProgram.getManager().hasVariable(renamingIt->second)) {
+                            onlyLocalVariablesRenamed = false;
+                            break;
+                        }
+                        renamedVariables.push_back(originalProgram.getManager().getVariable(renamingIt->second));
+                    }
+                    if (onlyLocalVariablesRenamed) {
+                        moduleIndices.push_back(moduleIndex);
+                        moduleVariables.push_back(std::move(renamedVariables));
+                    } else {
+                        STORM_LOG_INFO("Module '" << module.getName() << "' is not considered symmetric to module '" << baseModule.getName() << "', because its renaming does not only affect local variables.");
+                    }
+                }
+                if (moduleIndices.size() < 2) {
+                    continue;
+                }
+
+                // Check that corresponding variables are stored in the same way.
+                bool symmetric = true;
+                Group group;
+                group.numberOfModules = moduleIndices.size();
+                for (uint64_t variableIndex = 0; symmetric && variableIndex < baseVariables.size(); ++variableIndex) {
+                    auto const& baseBits = variableToBits.at(baseVariables[variableIndex]);
+                    group.bitWidths.push_back(baseBits.second);
+                    for (auto const& variables : moduleVariables) {
+                        auto const& bits = variableToBits.at(variables[variableIndex]);
+                        auto lowerBoundIt = variableToLowerBound.find(variables[variableIndex]);
+                        symmetric &= bits.second == baseBits.second && (lowerBoundIt == variableToLowerBound.end() || lowerBoundIt->second == variableToLowerBound.at(baseVariables[variableIndex]));
+                    }
+                }
+                for (auto const& variables : moduleVariables) {
+                    for (auto const& variable : variables) {
+                        group.bitOffsets.push_back(variableToBits.at(variable).first);
+                    }
+                }
+
+                // Check that no module refers to the local variables of modules of the group other than itself.
+                std::set<storm::expressions::Variable> groupVariables;
+                for (auto const& variables : moduleVariables) {
+                    groupVariables.insert(variables.begin(), variables.end());
+                }
+                for (uint64_t moduleIndex = 0; symmetric && moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                    std::set<storm::expressions::Variable> ownVariables;
+                    auto memberIt = std::find(moduleIndices.begin(), moduleIndices.end(), moduleIndex);
+                    if (memberIt != moduleIndices.end()) {
+                        auto const& variables = moduleVariables[std::distance(moduleIndices.begin(), memberIt)];
+                        ownVariables.insert(variables.begin(), variables.end());
+                    }
+                    for (auto const& variable : referencedVariables[moduleIndex]) {
+                        if (groupVariables.count(variable) > 0 && ownVariables.count(variable) == 0) {
+                            STORM_LOG_INFO("Modules obtained from module '" << baseModule.getName() << "' are not symmetric, because module '" << program.getModule(moduleIndex).getName() << "' refers to variable '" << variable.getName() << "'.");
+                            symmetric = false;
+                            break;
+                        }
+                    }
+                }
+
+                // Check that the visible expressions are invariant under a transposition and a cycle of the modules,
+                // which together generate all permutations.
+                std::vector<std::vector<uint64_t>> generators;
+                std::vector<uint64_t> transposition(moduleIndices.size());
+                std::iota(transposition.begin(), transposition.end(), 0);
+                std::swap(transposition[0], transposition[1]);
+                generators.push_back(transposition);
+                if (moduleIndices.size() > 2) {
+                    std::vector<uint64_t> cycle(moduleIndices.size());
+                    for (uint64_t index = 0; index < cycle.size(); ++index) {
+                        cycle[index] = (index + 1) % cycle.size();
+                    }
+                    generators.push_back(cycle);
+                }
+                for (auto const& generator : generators) {
+                    if (!symmetric) {
+                        break;
+                    }
+                    std::map<storm::expressions::Variable, storm::expressions::Expression> permutation;
+                    for (uint64_t index = 0; index < moduleVariables.size(); ++index) {
+                        for (uint64_t variableIndex = 0; variableIndex < baseVariables.size(); ++variableIndex) {
+                            permutation.emplace(moduleVariables[index][variableIndex], moduleVariables[generator[index]][variableIndex].getExpression());
+                        }
+                    }
+                    for (auto const& expression : visibleExpressions) {
+                        std::set<storm::expressions::Variable> variables = expression.getVariables();
+                        if (std::none_of(variables.begin(), variables.end(), [&groupVariables] (storm::expressions::Variable const& variable) { return groupVariables.count(variable) > 0; })) {
+                            continue;
+                        }
+#if defined(STORM_HAVE_Z3) || defined(STORM_HAVE_MSAT)
+                        if (!solver) {
+                            solver = storm::utility::solver::SmtSolverFactory().create(program.getManager());
+                            for (auto const& rangeExpression : program.getAllRangeExpressions()) {
+                                solver->add(rangeExpression);
+                            }
+                        }
+#endif
+                        if (!isInvariant(expression, permutation, solver.get())) {
+                            STORM_LOG_INFO("Modules obtained from module '" << baseModule.getName() << "' are not symmetric, because expression '" << expression << "' is not invariant under their permutation.");
+                            symmetric = false;
+                            break;
+                        }
+                    }
+                }
+
+                if (symmetric) {
+                    STORM_LOG_INFO("Reducing the state space by the symmetry of " << moduleIndices.size() << " modules obtained from module '" << baseModule.getName() << "'.");
+                    groups.push_back(std::move(group));
+                }
+            }
+        }
+
+        bool PrismModuleSymmetry::hasSymmetries() const {
+            return !groups.empty();
+        }
+
+        void PrismModuleSymmetry::canonicalize(CompressedState& state) const {
+            for (auto const& group : groups) {
+                uint64_t numberOfVariables = group.bitWidths.size();
+
+                // Read the values of all modules.
+                values.resize(group.numberOfModules * numberOfVariables);
+                for (uint64_t module = 0; module < group.numberOfModules; ++module) {
+                    for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                        uint64_t index = module * numberOfVariables + variable;
+                        values[index] = state.getAsInt(group.bitOffsets[index], group.bitWidths[variable]);
+                    }
+                }
+
+                // Sort the modules lexicographically by their values.
+                order.resize(group.numberOfModules);
+                std::iota(order.begin(), order.end(), 0);
+                std::sort(order.begin(), order.end(), [this, numberOfVariables] (uint64_t const& first, uint64_t const& second) {
+                    return std::lexicographical_compare(values.begin() + first * numberOfVariables, values.begin() + (first + 1) * numberOfVariables, values.begin() + second * numberOfVariables, values.begin() + (second + 1) * numberOfVariables);
+                });
+
+                // Write the values back in sorted order.
+                for (uint64_t module = 0; module < group.numberOfModules; ++module) {
+                    if (order[module] == module) {
+                        continue;
+                    }
+                    for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                        state.setFromInt(group.bitOffsets[module * numberOfVariables + variable], group.bitWidths[variable], values[order[module] * numberOfVariables + variable]);
+                    }
+                }
+            }
+        }
+
+        bool PrismModuleSymmetry::isInvariant(storm::expressions::Expression const& expression, std::map<storm::expressions::Variable, storm::expressions::Expression> const& permutation, storm::solver::SmtSolver* solver) const {
+            storm::expressions::Expression permutedExpression = expression.substitute(permutation);
+            if (permutedExpression.toString() == expression.toString()) {
+                return true;
+            }
+            if (solver == nullptr) {
+                return false;
+            }
+
+            solver->push();
+            if (expression.hasBooleanType()) {
+                solver->add(!storm::expressions::iff(expression, permutedExpression));
+            } else {
+                solver->add(expression != permutedExpression);
+            }
+            bool invariant = solver->check() == storm::solver::SmtSolver::CheckResult::Unsat;
+            solver->pop();
+            return invariant;
+        }
+
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+
+    namespace solver {
+        class SmtSolver;
+    }
+
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * Detects groups of fully symmetric modules in a PRISM program and canonicalizes states with respect to the
+         * permutations of these modules.
+         *
+         * A group consists of a module and all modules that were obtained from it by renaming only its local
+         * variables. The group is fully symmetric if no command of a module refers to the local variables of the
+         * other modules of the group, no module outside the group refers to the local variables of the group and all
+         * given visible expressions are invariant under permutations of the modules. Two states that only differ in
+         * the order of the values of the modules of a group are then bisimilar, and the representative of a state is
+         * obtained by sorting the blocks of values of the modules of each group.
+         */
+        class PrismModuleSymmetry {
+        public:
+            /*!
+             * Detects the symmetric module groups.
+             *
+             * @param originalProgram The program as given by the user, which is needed to retrieve the renamings of
+             * modules.
+             * @param program The program in which constants and formulas have been substituted.
+             * @param variableInformation The layout of the states.
+             * @param visibleExpressions Expressions (e.g. of labels and rewards) that need to be preserved.
+             */
+            PrismModuleSymmetry(storm::prism::Program const& originalProgram, storm::prism::Program const& program, VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& visibleExpressions);
+
+            /*!
+             * Retrieves whether at least one symmetric module group was found.
+             */
+            bool hasSymmetries() const;
+
+            /*!
+             * Replaces the given state by the representative of its orbit.
+             */
+            void canonicalize(CompressedState& state) const;
+
+        private:
+            struct Group {
+                // The number of modules of the group.
+                uint64_t numberOfModules;
+
+                // For each module and each of its variables, the bit offset of the variable. The variables of all
+                // modules appear in the same order.
+                std::vector<uint64_t> bitOffsets;
+
+                // For each variable, its bit width.
+                std::vector<uint64_t> bitWidths;
+            };
+
+            /*!
+             * Checks whether the given expression is invariant under the given permutation of variables. If the
+             * permuted expression is not syntactically equal, the given solver (if any) is used to check equivalence.
+             */
+            bool isInvariant(storm::expressions::Expression const& expression, std::map<storm::expressions::Variable, storm::expressions::Expression> const& permutation, storm::solver::SmtSolver* solver) const;
+
+            // The symmetric module groups.
+            std::vector<Group> groups;
+
+            // Buffers used for the canonicalization.
+            mutable std::vector<uint64_t> values;
+            mutable std::vector<uint64_t> order;
+        };
+
+    }
+}
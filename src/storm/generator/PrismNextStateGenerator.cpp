@@ -1,5 +1,7 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <algorithm>
+
 #include <boost/container/flat_map.hpp>
 #include <boost/any.hpp>
 
@@ -23,11 +25,14 @@ namespace storm {
         
         template<typename ValueType, typename StateType>
         PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options) : PrismNextStateGenerator<ValueType, StateType>(program.substituteConstantsFormulas(), options, false) {
-            // Intentionally left empty.
+            // The renamings of modules are only available in the original program, so symmetries are detected here.
+            if (this->options.isSymmetryReductionSet()) {
+                initializeSymmetryReduction(program);
+            }
         }
         
         template<typename ValueType, typename StateType>
-        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options), program(program), rewardModels(), hasStateActionRewards(false) {
+        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options), program(program), rewardModels(), hasStateActionRewards(false), numberOfKnownStates(0) {
             STORM_LOG_TRACE("Creating next-state generator for PRISM program: " << program);
             STORM_LOG_THROW(!this->program.specifiesSystemComposition(), storm::exceptions::WrongFormatException, "The explicit next-state generator currently does not support custom system compositions.");
                         
@@ -38,6 +43,9 @@ namespace storm {
             // Create a proper evalator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
             
+            // Compile the expressions that are evaluated most frequently.
+            compileExpressions();
+            
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& rewardModel : this->program.getRewardModels()) {
                     rewardModels.push_back(rewardModel);
@@ -80,8 +88,131 @@ namespace storm {
                     }
                 }
             }
+            
+            if (this->options.isPartialOrderReductionSet()) {
+                initializePartialOrderReduction();
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::initializePartialOrderReduction() {
+            if (program.getModelType() != storm::prism::Program::ModelType::MDP) {
+                STORM_LOG_WARN("Partial-order reduction is only applied to MDPs.");
+                return;
+            }
+            
+            // Collect the variables and actions that the reduction must not hide.
+            std::set<storm::expressions::Variable> visibleVariables;
+            for (auto const& expression : getVisibleExpressions()) {
+                std::set<storm::expressions::Variable> variables = expression.getVariables();
+                visibleVariables.insert(variables.begin(), variables.end());
+            }
+            std::set<uint64_t> visibleActionIndices;
+            for (auto const& rewardModel : rewardModels) {
+                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    visibleActionIndices.insert(stateActionReward.getActionIndex());
+                }
+                for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+                    visibleActionIndices.insert(transitionReward.getActionIndex());
+                }
+            }
+            
+            independenceAnalysis = PrismIndependenceAnalysis(program, visibleVariables, visibleActionIndices);
         }
 
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::initializeSymmetryReduction(storm::prism::Program const& originalProgram) {
+            if (program.isPartiallyObservable()) {
+                STORM_LOG_WARN("Symmetry reduction is not applied to partially observable models.");
+                return;
+            }
+            
+            PrismModuleSymmetry moduleSymmetry(originalProgram, program, this->variableInformation, getVisibleExpressions());
+            if (moduleSymmetry.hasSymmetries()) {
+                symmetryReduction = std::move(moduleSymmetry);
+            } else {
+                STORM_LOG_WARN("Symmetry reduction was requested, but no symmetric modules were found.");
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        std::vector<storm::expressions::Expression> PrismNextStateGenerator<ValueType, StateType>::getVisibleExpressions() const {
+            std::vector<storm::expressions::Expression> result;
+            for (auto const& label : program.getLabels()) {
+                if (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().count(label.getName()) > 0) {
+                    result.push_back(label.getStatePredicateExpression());
+                }
+            }
+            for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                result.push_back(expressionLabel.second);
+            }
+            for (auto const& expressionBool : this->terminalStates) {
+                result.push_back(expressionBool.first);
+            }
+            for (auto const& rewardModel : rewardModels) {
+                for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+                    result.push_back(stateReward.getStatePredicateExpression());
+                    result.push_back(stateReward.getRewardValueExpression());
+                }
+                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    result.push_back(stateActionReward.getStatePredicateExpression());
+                    result.push_back(stateActionReward.getRewardValueExpression());
+                }
+                for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+                    result.push_back(transitionReward.getSourceStatePredicateExpression());
+                    result.push_back(transitionReward.getTargetStatePredicateExpression());
+                    result.push_back(transitionReward.getRewardValueExpression());
+                }
+            }
+            return result;
+        }
+
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+            StateExpressionCompiler compiler(this->variableInformation);
+            
+            uint64_t numberOfCommands = 0;
+            uint64_t numberOfUpdates = 0;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    numberOfCommands = std::max<uint64_t>(numberOfCommands, command.getGlobalIndex() + 1);
+                    for (auto const& update : command.getUpdates()) {
+                        numberOfUpdates = std::max<uint64_t>(numberOfUpdates, update.getGlobalIndex() + 1);
+                    }
+                }
+            }
+            compiledGuards.resize(numberOfCommands);
+            compiledAssignments.resize(numberOfUpdates);
+            
+            uint64_t numberOfCompiledExpressions = 0;
+            uint64_t numberOfExpressions = 0;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    compiledGuards[command.getGlobalIndex()] = compiler.compile(command.getGuardExpression());
+                    numberOfCompiledExpressions += compiledGuards[command.getGlobalIndex()] ? 1 : 0;
+                    ++numberOfExpressions;
+                    for (auto const& update : command.getUpdates()) {
+                        std::vector<boost::optional<CompiledStateExpression>>& updateAssignments = compiledAssignments[update.getGlobalIndex()];
+                        for (auto const& assignment : update.getAssignments()) {
+                            updateAssignments.push_back(compiler.compile(assignment.getExpression()));
+                            numberOfCompiledExpressions += updateAssignments.back() ? 1 : 0;
+                            ++numberOfExpressions;
+                        }
+                    }
+                }
+            }
+            STORM_LOG_DEBUG("Compiled " << numberOfCompiledExpressions << " of " << numberOfExpressions << " guards and assignments.");
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isEnabled(storm::prism::Command const& command) const {
+            boost::optional<CompiledStateExpression> const& compiledGuard = compiledGuards[command.getGlobalIndex()];
+            if (compiledGuard) {
+                return compiledGuard->evaluateAsBool(*this->state);
+            }
+            return this->evaluator->asBool(command.getGuardExpression());
+        }
+        
         template<typename ValueType, typename StateType>
         bool PrismNextStateGenerator<ValueType, StateType>::canHandle(storm::prism::Program const& program) {
             // We can handle all valid prism programs (except for PTAs)
@@ -148,8 +279,17 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> PrismNextStateGenerator<ValueType, StateType>::clone() const {
+            // The program was already preprocessed, so we can skip the substitution of constants and formulas.
+            std::shared_ptr<PrismNextStateGenerator<ValueType, StateType>> result(new PrismNextStateGenerator<ValueType, StateType>(program, this->options, false));
+            result->symmetryReduction = symmetryReduction;
+            return result;
+        }
+        
+        template<typename ValueType, typename StateType>
+        std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& originalStateToIdCallback) {
             std::vector<StateType> initialStateIndices;
+            StateToIdCallback stateToIdCallback = getCanonicalizingCallback(originalStateToIdCallback);
 
             // If all states are initial, we can simplify the enumeration substantially.
             if (program.hasInitialConstruct() && program.getInitialConstruct().getInitialStatesExpression().isTrue()) {
@@ -253,26 +393,41 @@ namespace storm {
                 STORM_LOG_DEBUG("Enumerated " << initialStateIndices.size() << " initial states using SMT solving.");
             }
             
+            // Symmetric initial states are mapped to the same representative.
+            if (symmetryReduction) {
+                std::sort(initialStateIndices.begin(), initialStateIndices.end());
+                initialStateIndices.erase(std::unique(initialStateIndices.begin(), initialStateIndices.end()), initialStateIndices.end());
+            }
+            
+            if (independenceAnalysis) {
+                for (auto const& index : initialStateIndices) {
+                    numberOfKnownStates = std::max<uint64_t>(numberOfKnownStates, static_cast<uint64_t>(index) + 1);
+                }
+            }
             return initialStateIndices;
         }
         
+        template<typename ValueType, typename StateType>
+        typename PrismNextStateGenerator<ValueType, StateType>::StateToIdCallback PrismNextStateGenerator<ValueType, StateType>::getCanonicalizingCallback(StateToIdCallback const& stateToIdCallback) {
+            if (!symmetryReduction) {
+                return stateToIdCallback;
+            }
+            return [this, &stateToIdCallback] (CompressedState const& state) {
+                canonicalState = state;
+                symmetryReduction->canonicalize(canonicalState);
+                return stateToIdCallback(canonicalState);
+            };
+        }
+        
         template<typename ValueType, typename StateType>
         StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
             // Prepare the result, in case we return early.
             StateBehavior<ValueType, StateType> result;
             
             // First, construct the state rewards, as we may return early if there are no choices later and we already
-            // need the state rewards then.
-            for (auto const& rewardModel : rewardModels) {
-                ValueType stateRewardValue = storm::utility::zero<ValueType>();
-                if (rewardModel.get().hasStateRewards()) {
-                    for (auto const& stateReward : rewardModel.get().getStateRewards()) {
-                        if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
-                            stateRewardValue += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
-                        }
-                    }
-                }
-                result.addStateReward(stateRewardValue);
+            // need the state rewards then. If their evaluation is deferred, we only add placeholders.
+            for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+                result.addStateReward(this->options.isDeferStateRewardsSet() ? storm::utility::zero<ValueType>() : evaluateStateReward(rewardModelIndex));
             }
             
             // If a terminal expression was set and we must not expand this state, return now.
@@ -287,19 +442,43 @@ namespace storm {
             // Get all choices for the state.
             result.setExpanded();
             
+            // If symmetry reduction is applied, successor states need to be replaced by their representatives.
+            StateToIdCallback const* callback = &stateToIdCallback;
+            StateToIdCallback canonicalizingCallback;
+            if (symmetryReduction) {
+                canonicalizingCallback = getCanonicalizingCallback(stateToIdCallback);
+                callback = &canonicalizingCallback;
+            }
+            
+            // If partial-order reduction is applied, we need to keep track of which states are known.
+            StateToIdCallback trackingCallback;
+            if (independenceAnalysis) {
+                trackingCallback = [this, callback] (CompressedState const& state) {
+                    StateType index = (*callback)(state);
+                    numberOfKnownStates = std::max<uint64_t>(numberOfKnownStates, static_cast<uint64_t>(index) + 1);
+                    return index;
+                };
+                callback = &trackingCallback;
+            }
+            
             std::vector<Choice<ValueType>> allChoices;
             if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
                 // First explore only edges without a rate
-                allChoices = getUnlabeledChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
-                addLabeledChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
+                allChoices = getUnlabeledChoices(*this->state, *callback, CommandFilter::Probabilistic);
+                addLabeledChoices(allChoices, *this->state, *callback, CommandFilter::Probabilistic);
                 if (allChoices.empty()) {
                     // Expand the Markovian edges if there are no probabilistic ones.
-                    allChoices = getUnlabeledChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
-                    addLabeledChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
+                    allChoices = getUnlabeledChoices(*this->state, *callback, CommandFilter::Markovian);
+                    addLabeledChoices(allChoices, *this->state, *callback, CommandFilter::Markovian);
                 }
             } else {
-                allChoices = getUnlabeledChoices(*this->state, stateToIdCallback);
-                addLabeledChoices(allChoices, *this->state, stateToIdCallback);
+                if (independenceAnalysis) {
+                    allChoices = getAmpleChoices(*this->state, *callback);
+                }
+                if (allChoices.empty()) {
+                    allChoices = getUnlabeledChoices(*this->state, *callback);
+                    addLabeledChoices(allChoices, *this->state, *callback);
+                }
             }
             
             std::size_t totalNumberOfChoices = allChoices.size();
@@ -379,8 +558,9 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
-            CompressedState newState(state);
+        void PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update, CompressedState& newState) {
+            STORM_LOG_ASSERT(&state != &newState, "The target state must not alias the source state.");
+            newState = state;
             
             // NOTE: the following process assumes that the assignments of the update are ordered in such a way that the
             // assignments to boolean variables precede the assignments to all integer variables and that within the
@@ -390,25 +570,30 @@ namespace storm {
             auto assignmentIt = update.getAssignments().begin();
             auto assignmentIte = update.getAssignments().end();
             
+            // Note that the assignments need to be evaluated in the currently loaded state and not in the given one.
+            auto compiledAssignmentIt = compiledAssignments[update.getGlobalIndex()].begin();
+            
             // Iterate over all boolean assignments and carry them out.
             auto boolIt = this->variableInformation.booleanVariables.begin();
             for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
                 while (assignmentIt->getVariable() != boolIt->variable) {
                     ++boolIt;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                newState.set(boolIt->bitOffset, *compiledAssignmentIt ? (*compiledAssignmentIt)->evaluateAsBool(*this->state) : this->evaluator->asBool(assignmentIt->getExpression()));
+                ++compiledAssignmentIt;
             }
             
             // Iterate over all integer assignments and carry them out.
             auto integerIt = this->variableInformation.integerVariables.begin();
-            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt) {
+            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt, ++compiledAssignmentIt) {
                 while (assignmentIt->getVariable() != integerIt->variable) {
                     ++integerIt;
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                int_fast64_t assignedValue = *compiledAssignmentIt ? (*compiledAssignmentIt)->evaluateAsInt(*this->state) : this->evaluator->asInt(assignmentIt->getExpression());
                 if (this->options.isAddOutOfBoundsStateSet()) {
                     if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
-                        return this->outOfBoundsState;
+                        newState = this->outOfBoundsState;
+                        return;
                     }
                 } else if (integerIt->forceOutOfBoundsCheck || this->options.isExplorationChecksSet()) {
                     STORM_LOG_THROW(assignedValue >= integerIt->lowerBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getVariableName() << "'.");
@@ -420,8 +605,6 @@ namespace storm {
             
             // Check that we processed all assignments.
             STORM_LOG_ASSERT(assignmentIt == assignmentIte, "Not all assignments were consumed.");
-            
-            return newState;
         }
         
         struct ActiveCommandData {
@@ -469,7 +652,7 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (this->isEnabled(command)) {
                         // Found the first enabled command for this module.
                         hasOneEnabledCommand = true;
                         activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
@@ -503,7 +686,7 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (this->isEnabled(command)) {
                         commands.push_back(command);
                     }
                 }
@@ -538,58 +721,101 @@ namespace storm {
                     }
 
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!this->isEnabled(command)) {
                         continue;
                     }
                     
-                    result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-                    Choice<ValueType>& choice = result.back();
+                    addUnlabeledChoice(result, command, state, stateToIdCallback);
+                }
+            }
+            
+            return result;
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::addUnlabeledChoice(std::vector<Choice<ValueType>>& choices, storm::prism::Command const& command, CompressedState const& state, StateToIdCallback stateToIdCallback) {
+            choices.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
+            Choice<ValueType>& choice = choices.back();
+            
+            // Remember the choice origin only if we were asked to.
+            if (this->options.isBuildChoiceOriginsSet()) {
+                CommandSet commandIndex { command.getGlobalIndex() };
+                choice.addOriginData(boost::any(std::move(commandIndex)));
+            }
+            
+            // Iterate over all updates of the current command.
+            ValueType probabilitySum = storm::utility::zero<ValueType>();
+            for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
+                storm::prism::Update const& update = command.getUpdate(k);
+
+                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                if (probability != storm::utility::zero<ValueType>()) {
+                    // Obtain target state index and add it to the list of known states. If it has not yet been
+                    // seen, we also add it to the set of states that have yet to be explored.
+                    CompressedState& newState = this->getScratchState();
+                    applyUpdate(state, update, newState);
+                    StateType stateIndex = stateToIdCallback(newState);
                     
-                    // Remember the choice origin only if we were asked to.
-                    if (this->options.isBuildChoiceOriginsSet()) {
-                        CommandSet commandIndex { command.getGlobalIndex() };
-                        choice.addOriginData(boost::any(std::move(commandIndex)));
+                    // Update the choice by adding the probability/target state to it.
+                    choice.addProbability(stateIndex, probability);
+                    if (this->options.isExplorationChecksSet()) {
+                        probabilitySum += probability;
                     }
-                    
-                    // Iterate over all updates of the current command.
-                    ValueType probabilitySum = storm::utility::zero<ValueType>();
-                    for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
-                        storm::prism::Update const& update = command.getUpdate(k);
-
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
-                        if (probability != storm::utility::zero<ValueType>()) {
-                            // Obtain target state index and add it to the list of known states. If it has not yet been
-                            // seen, we also add it to the set of states that have yet to be explored.
-                            StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
-                            
-                            // Update the choice by adding the probability/target state to it.
-                            choice.addProbability(stateIndex, probability);
-                            if (this->options.isExplorationChecksSet()) {
-                                probabilitySum += probability;
-                            }
+                }
+            }
+            
+            // Create the state-action reward for the newly created choice.
+            for (auto const& rewardModel : rewardModels) {
+                ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
+                if (rewardModel.get().hasStateActionRewards()) {
+                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                        if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
+                            stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
                         }
                     }
-                    
-                    // Create the state-action reward for the newly created choice.
-                    for (auto const& rewardModel : rewardModels) {
-                        ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                        if (rewardModel.get().hasStateActionRewards()) {
-                            for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                                if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                    stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                                }
-                            }
+                }
+                choice.addReward(stateActionRewardValue);
+            }
+            
+            if (this->options.isExplorationChecksSet()) {
+                // Check that the resulting distribution is in fact a distribution.
+                STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException, "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAmpleChoices(CompressedState const& state, StateToIdCallback stateToIdCallback) {
+            std::vector<Choice<ValueType>> result;
+            for (uint64_t moduleIndex : independenceAnalysis->getIndependentModuleIndices()) {
+                // The module provides an ample set if exactly one of its commands is enabled and this command is
+                // unlabeled.
+                storm::prism::Command const* enabledCommand = nullptr;
+                bool uniquelyEnabled = true;
+                for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+                    if (this->isEnabled(command)) {
+                        if (enabledCommand != nullptr) {
+                            uniquelyEnabled = false;
+                            break;
                         }
-                        choice.addReward(stateActionRewardValue);
-                    }
-                    
-                    if (this->options.isExplorationChecksSet()) {
-                        // Check that the resulting distribution is in fact a distribution.
-                        STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException, "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
+                        enabledCommand = &command;
                     }
                 }
+                if (enabledCommand == nullptr || !uniquelyEnabled || enabledCommand->isLabeled()) {
+                    continue;
+                }
+                
+                // Only use the ample set if all of its successors are new, because otherwise it may close a cycle
+                // along which the other commands are postponed forever. Either way, we do not try other modules,
+                // because the successors that were just found must be reachable from this state.
+                uint64_t previouslyKnownStates = numberOfKnownStates;
+                addUnlabeledChoice(result, *enabledCommand, state, stateToIdCallback);
+                Choice<ValueType> const& choice = result.back();
+                bool allSuccessorsNew = choice.size() > 0 && std::all_of(choice.begin(), choice.end(), [previouslyKnownStates] (auto const& stateProbabilityPair) { return static_cast<uint64_t>(stateProbabilityPair.first) >= previouslyKnownStates; });
+                if (!allSuccessorsNew) {
+                    result.clear();
+                }
+                break;
             }
-            
             return result;
         }
 
@@ -607,7 +833,10 @@ namespace storm {
                 storm::prism::Command const& command = *iteratorList[position];
                 for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
                     storm::prism::Update const& update = command.getUpdate(j);
-                    generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()), position + 1, iteratorList, distribution, stateToIdCallback);
+                    // Each recursion level uses its own scratch state, so the given state is not overwritten.
+                    CompressedState& newState = this->getScratchState(position);
+                    applyUpdate(state, update, newState);
+                    generateSynchronizedDistribution(newState, probability * this->evaluator->asRational(update.getLikelihoodExpression()), position + 1, iteratorList, distribution, stateToIdCallback);
                 }
             }
         }
@@ -748,6 +977,25 @@ namespace storm {
             return storm::builder::RewardModelInformation(rewardModel.getName(), rewardModel.hasStateRewards(), rewardModel.hasStateActionRewards(), rewardModel.hasTransitionRewards());
         }
         
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isStateRewardEvaluationDeferred() const {
+            return this->options.isDeferStateRewardsSet();
+        }
+        
+        template<typename ValueType, typename StateType>
+        ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateStateReward(uint64_t rewardModelIndex) const {
+            ValueType result = storm::utility::zero<ValueType>();
+            storm::prism::RewardModel const& rewardModel = rewardModels[rewardModelIndex].get();
+            if (rewardModel.hasStateRewards()) {
+                for (auto const& stateReward : rewardModel.getStateRewards()) {
+                    if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
+                        result += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
+                    }
+                }
+            }
+            return result;
+        }
+        
         template<typename ValueType, typename StateType>
         std::shared_ptr<storm::storage::sparse::ChoiceOrigins> PrismNextStateGenerator<ValueType, StateType>::generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const {
             if (!this->getOptions().isBuildChoiceOriginsSet()) {
@@ -2,6 +2,9 @@
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/PrismIndependenceAnalysis.h"
+#include "storm/generator/PrismModuleSymmetry.h"
 
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/BoostTypes.h"
@@ -36,12 +39,15 @@ namespace storm {
             virtual bool isDeterministicModel() const override;
             virtual bool isDiscreteTimeModel() const override;
             virtual bool isPartiallyObservable() const override;
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
             virtual std::vector<StateType> getInitialStates(StateToIdCallback const& stateToIdCallback) override;
 
             virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
 
             virtual std::size_t getNumberOfRewardModels() const override;
             virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
+            virtual bool isStateRewardEvaluationDeferred() const override;
+            virtual ValueType evaluateStateReward(uint64_t rewardModelIndex) const override;
             
             virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices = {}, std::vector<StateType> const& deadlockStateIndices = {}) override;
 
@@ -57,14 +63,25 @@ namespace storm {
              */
             PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool flag);
             
+            /*!
+             * Compiles the guards and assignments of the program against the layout of the states.
+             */
+            void compileExpressions();
+            
+            /*!
+             * Checks whether the guard of the given command is satisfied in the currently loaded state.
+             */
+            bool isEnabled(storm::prism::Command const& command) const;
+            
             /*!
              * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
              * the given compressed state.
              * @params state The state to which to apply the new values.
              * @params update The update to apply.
-             * @return The resulting state.
+             * @params newState The state into which the result is written. Its memory is reused, so passing one of
+             * the scratch states avoids allocating memory. It must not alias the given state.
              */
-            CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
+            void applyUpdate(CompressedState const& state, storm::prism::Update const& update, CompressedState& newState);
             
             /*!
              * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
@@ -92,6 +109,49 @@ namespace storm {
              */
             std::vector<Choice<ValueType>> getUnlabeledChoices(CompressedState const& state, StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter = CommandFilter::All);
             
+            /*!
+             * Adds the choice of the given unlabeled command, which must be enabled in the given state.
+             *
+             * @param choices The new choice is inserted in this vector.
+             * @param command The command whose choice to add.
+             * @param state The state for which to build the choice.
+             */
+            void addUnlabeledChoice(std::vector<Choice<ValueType>>& choices, storm::prism::Command const& command, CompressedState const& state, StateToIdCallback stateToIdCallback);
+            
+            /*!
+             * Tries to find an ample set for partial-order reduction in the given state. The ample set is given by
+             * the only enabled command of one of the independent modules. It is only used if all of its successor
+             * states were not known before, which rules out that the reduction ignores a cycle.
+             *
+             * @param state The state for which to retrieve the ample choices.
+             * @return The choices of the ample set or no choices if no ample set was found.
+             */
+            std::vector<Choice<ValueType>> getAmpleChoices(CompressedState const& state, StateToIdCallback stateToIdCallback);
+            
+            /*!
+             * Initializes the independence analysis used for partial-order reduction.
+             */
+            void initializePartialOrderReduction();
+            
+            /*!
+             * Initializes the detection of symmetric modules used for symmetry reduction.
+             *
+             * @param originalProgram The program before constants and formulas were substituted.
+             */
+            void initializeSymmetryReduction(storm::prism::Program const& originalProgram);
+            
+            /*!
+             * Retrieves the expressions that determine the labels, terminal states and rewards of the states and
+             * thus must be preserved by reductions of the state space.
+             */
+            std::vector<storm::expressions::Expression> getVisibleExpressions() const;
+            
+            /*!
+             * Retrieves a callback that replaces states by their representatives before passing them to the given
+             * callback. If no symmetry reduction is applied, the given callback is returned.
+             */
+            StateToIdCallback getCanonicalizingCallback(StateToIdCallback const& stateToIdCallback);
+            
             /*!
              * Retrieves all labeled choices possible from the given state.
              *
@@ -120,6 +180,28 @@ namespace storm {
             
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            // The compiled guards (indexed by the global command index). If a guard could not be compiled, it is
+            // evaluated using the evaluator.
+            std::vector<boost::optional<CompiledStateExpression>> compiledGuards;
+            
+            // The compiled assignment expressions (indexed by the global update index and then in the order of the
+            // assignments of the update).
+            std::vector<std::vector<boost::optional<CompiledStateExpression>>> compiledAssignments;
+            
+            // If partial-order reduction is applied, this holds the modules that can provide ample sets.
+            boost::optional<PrismIndependenceAnalysis> independenceAnalysis;
+            
+            // The number of states that were assigned an index by the callbacks so far. New states are assigned
+            // consecutive indices, so states with an index below this number were known before. This is only
+            // tracked if partial-order reduction is applied.
+            uint64_t numberOfKnownStates;
+            
+            // If symmetry reduction is applied, this holds the symmetric module groups.
+            boost::optional<PrismModuleSymmetry> symmetryReduction;
+            
+            // A buffer for the representatives of states.
+            CompressedState canonicalState;
         };
         
     }
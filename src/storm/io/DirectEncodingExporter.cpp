@@ -121,7 +121,9 @@ namespace storm {
                 os << std::endl;
                 // Write state valuations as comments
                 if(sparseModel->hasStateValuations()) {
-                    os << "//" << sparseModel->getStateValuations().getStateInfo(group) << std::endl;
+                    os << "//";
+                    sparseModel->getStateValuations().printValuation(os, group);
+                    os << std::endl;
                 }
 
                 // Write probabilities
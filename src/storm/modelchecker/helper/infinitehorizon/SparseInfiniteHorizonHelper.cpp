@@ -1,5 +1,10 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <exception>
+#include <future>
+#include <mutex>
+#include <numeric>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
@@ -19,7 +24,10 @@
 #include "storm/utility/vector.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/NumberTraits.h"
 
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
@@ -141,11 +149,24 @@ namespace storm {
                 progress.setMaxCount( _longRunComponentDecomposition->size());
                 progress.startNewMeasurement(0);
                 STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
+                
+                uint64_t numberOfThreads = std::min<uint64_t>(env.solver().lra().getNumberOfThreads(), _longRunComponentDecomposition->size());
+                if (numberOfThreads > 1 && !storm::NumberTraits<ValueType>::SupportsConcurrency) {
+                    STORM_LOG_WARN("Components are only analyzed concurrently for floating-point computations. Falling back to a single thread.");
+                    numberOfThreads = 1;
+                } else if (numberOfThreads > 1 && !supportsConcurrentComponentAnalysis(underlyingSolverEnvironment)) {
+                    STORM_LOG_WARN("Components can not be analyzed concurrently with the selected LRA method. Falling back to a single thread.");
+                    numberOfThreads = 1;
+                }
                 std::vector<ValueType> componentLraValues;
-                componentLraValues.reserve(_longRunComponentDecomposition->size());
-                for (auto const& c : *_longRunComponentDecomposition) {
-                    componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-                    progress.updateProgress(componentLraValues.size());
+                if (numberOfThreads > 1) {
+                    componentLraValues = computeLraForComponentsConcurrently(underlyingSolverEnvironment, numberOfThreads, stateRewardsGetter, actionRewardsGetter, progress);
+                } else {
+                    componentLraValues.reserve(_longRunComponentDecomposition->size());
+                    for (auto const& c : *_longRunComponentDecomposition) {
+                        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
+                        progress.updateProgress(componentLraValues.size());
+                    }
                 }
                 
                 // Solve the resulting SSP where end components are collapsed into single auxiliary states
@@ -153,6 +174,105 @@ namespace storm {
                 return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
             }
             
+            template <typename ValueType, bool Nondeterministic>
+            bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::supportsConcurrentComponentAnalysis(Environment const& env) const {
+                return true;
+            }
+            
+            template <typename ValueType, bool Nondeterministic>
+            std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeLraForComponentsConcurrently(Environment const& env, uint64_t numberOfThreads, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter, storm::utility::ProgressMeasurement& progress) {
+                uint64_t numberOfComponents = _longRunComponentDecomposition->size();
+                STORM_LOG_INFO("Analyzing " << numberOfComponents << " components with " << numberOfThreads << " threads.");
+                
+                // Handing out the large components first avoids that a single thread is busy with a large component while the others are idle.
+                std::vector<uint64_t> componentOrder(numberOfComponents);
+                std::iota(componentOrder.begin(), componentOrder.end(), 0);
+                std::stable_sort(componentOrder.begin(), componentOrder.end(), [this] (uint64_t const& lhs, uint64_t const& rhs) { return _longRunComponentDecomposition->getBlock(lhs).size() > _longRunComponentDecomposition->getBlock(rhs).size(); });
+                
+                // Trivial components are analyzed with a few operations, so a thread takes several of them at once.
+                uint64_t const minimalBatchSize = 256;
+                
+                // The environment creates its sub-environments on first access, so every thread gets its own copy.
+                std::vector<Environment> threadEnvironments(numberOfThreads, env);
+                
+                // The shared state of the threads, which is only accessed while holding the mutex.
+                std::mutex mutex;
+                uint64_t nextComponent = 0;
+                uint64_t numberOfAnalyzedComponents = 0;
+                bool aborted = false;
+                
+                std::vector<ValueType> componentLraValues(numberOfComponents);
+                auto worker = [&] (uint64_t thread) {
+                    std::vector<uint64_t> batch;
+                    while (true) {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            numberOfAnalyzedComponents += batch.size();
+                            if (!batch.empty()) {
+                                progress.updateProgress(numberOfAnalyzedComponents);
+                            }
+                            batch.clear();
+                            
+                            uint64_t batchSize = 0;
+                            while (!aborted && nextComponent < numberOfComponents && batchSize < minimalBatchSize) {
+                                batch.push_back(componentOrder[nextComponent]);
+                                batchSize += _longRunComponentDecomposition->getBlock(componentOrder[nextComponent]).size();
+                                ++nextComponent;
+                            }
+                            if (batch.empty()) {
+                                return;
+                            }
+                        }
+                        
+                        try {
+                            for (auto const& componentIndex : batch) {
+                                componentLraValues[componentIndex] = computeLraForComponent(threadEnvironments[thread], stateValuesGetter, actionValuesGetter, _longRunComponentDecomposition->getBlock(componentIndex));
+                            }
+                        } catch (...) {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            aborted = true;
+                            throw;
+                        }
+                        
+                        if (storm::utility::resources::isTerminate()) {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            aborted = true;
+                            return;
+                        }
+                    }
+                };
+                
+                std::vector<std::future<void>> workers;
+                for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                    workers.push_back(std::async(std::launch::async, worker, thread));
+                }
+                std::exception_ptr exception;
+                try {
+                    worker(0);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+                
+                // Wait for all threads before rethrowing any exception, as they access the local state.
+                for (auto& future : workers) {
+                    future.wait();
+                }
+                for (auto& future : workers) {
+                    try {
+                        future.get();
+                    } catch (...) {
+                        if (!exception) {
+                            exception = std::current_exception();
+                        }
+                    }
+                }
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+                STORM_LOG_WARN_COND(!aborted, "Computation of long run average values aborted before analyzing all components.");
+                return componentLraValues;
+            }
+            
             template <typename ValueType, bool Nondeterministic>
             bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isContinuousTime() const {
                 STORM_LOG_ASSERT((_markovianStates == nullptr) || (_exitRates != nullptr), "Inconsistent information given: Have Markovian states but no exit rates." );
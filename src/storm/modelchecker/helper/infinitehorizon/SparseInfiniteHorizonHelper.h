@@ -9,6 +9,10 @@
 namespace storm {
     class Environment;
     
+    namespace utility {
+        class ProgressMeasurement;
+    }
+    
     namespace models {
         namespace sparse {
             template <typename VT> class StandardRewardModel;
@@ -121,6 +125,19 @@ namespace storm {
                  * @post if scheduler production is enabled and Nondeterministic is true, getProducedOptimalChoices() contains choices for all input model states which yield the returned LRA values.
                  */
                 virtual std::vector<ValueType> buildAndSolveSsp(Environment const& env, std::vector<ValueType> const& mecLraValues) = 0;
+                
+                /*!
+                 * @return true iff computeLraForComponent may be called concurrently for different components with the given environment.
+                 */
+                virtual bool supportsConcurrentComponentAnalysis(Environment const& env) const;
+                
+                /*!
+                 * Computes the LRA values of all components of the decomposition with the given number of threads.
+                 * Large components are handled one at a time, whereas small components are batched to reduce the synchronization overhead.
+                 * @pre computeLraForComponent must be safe to be called concurrently for different components.
+                 * @return the LRA value for each component (in the order of the decomposition)
+                 */
+                std::vector<ValueType> computeLraForComponentsConcurrently(Environment const& env, uint64_t numberOfThreads, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter, storm::utility::ProgressMeasurement& progress);
             
                 storm::storage::SparseMatrix<ValueType> const& _transitionMatrix;
                 storm::storage::BitVector const* _markovianStates;
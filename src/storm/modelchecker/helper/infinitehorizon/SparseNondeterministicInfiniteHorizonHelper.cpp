@@ -14,6 +14,9 @@
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
@@ -65,7 +68,7 @@ namespace storm {
                         this->_computedBackwardTransitions = std::make_unique<storm::storage::SparseMatrix<ValueType>>(this->_transitionMatrix.transpose(true));
                         this->_backwardTransitions = this->_computedBackwardTransitions.get();
                     }
-                    this->_computedLongRunComponentDecomposition = std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(this->_transitionMatrix, *this->_backwardTransitions);
+                    this->_computedLongRunComponentDecomposition = std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(this->_transitionMatrix, *this->_backwardTransitions, storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet());
                     this->_longRunComponentDecomposition = this->_computedLongRunComponentDecomposition.get();
                 }
             }
@@ -75,11 +78,14 @@ namespace storm {
                 // For models with potential nondeterminisim, we compute the LRA for a maximal end component (MEC)
                 
                 // Allocate memory for the nondeterministic choices.
+                // This is usually already done, in which case the choices are not touched as the components might be analyzed concurrently.
                 if (this->isProduceSchedulerSet()) {
                     if (!this->_producedOptimalChoices.is_initialized()) {
                         this->_producedOptimalChoices.emplace();
                     }
-                    this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+                    if (this->_producedOptimalChoices->size() != this->_transitionMatrix.getRowGroupCount()) {
+                        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+                    }
                 }
                 
                 auto trivialResult = this->computeLraForTrivialMec(env, stateRewardsGetter, actionRewardsGetter, component);
@@ -88,14 +94,7 @@ namespace storm {
                 }
                 
                 // Solve nontrivial MEC with the method specified in the settings
-                storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
-                if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::LinearProgramming) {
-                    STORM_LOG_INFO("Selecting 'LP' as the solution technique for long-run properties to guarantee exact results. If you want to override this, please explicitly specify a different LRA method.");
-                    method = storm::solver::LraMethod::LinearProgramming;
-                } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
-                    STORM_LOG_INFO("Selecting 'VI' as the solution technique for long-run properties to guarantee sound results. If you want to override this, please explicitly specify a different LRA method.");
-                    method = storm::solver::LraMethod::ValueIteration;
-                }
+                storm::solver::LraMethod method = getLraMethodForMecs(env);
                 STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration, "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
                 if (method == storm::solver::LraMethod::LinearProgramming) {
                     return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
@@ -106,6 +105,25 @@ namespace storm {
                 }
             }
             
+            template <typename ValueType>
+            storm::solver::LraMethod SparseNondeterministicInfiniteHorizonHelper<ValueType>::getLraMethodForMecs(Environment const& env) const {
+                storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
+                if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::LinearProgramming) {
+                    STORM_LOG_INFO("Selecting 'LP' as the solution technique for long-run properties to guarantee exact results. If you want to override this, please explicitly specify a different LRA method.");
+                    method = storm::solver::LraMethod::LinearProgramming;
+                } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
+                    STORM_LOG_INFO("Selecting 'VI' as the solution technique for long-run properties to guarantee sound results. If you want to override this, please explicitly specify a different LRA method.");
+                    method = storm::solver::LraMethod::ValueIteration;
+                }
+                return method;
+            }
+            
+            template <typename ValueType>
+            bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::supportsConcurrentComponentAnalysis(Environment const& env) const {
+                // The LP solvers (e.g. glpk) maintain global state and are thus not safe to be used concurrently.
+                return getLraMethodForMecs(env) != storm::solver::LraMethod::LinearProgramming;
+            }
+            
             template <typename ValueType>
             std::pair<bool, ValueType> SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForTrivialMec(Environment const& env, ValueGetter const& stateRewardsGetter, ValueGetter const& actionRewardsGetter, storm::storage::MaximalEndComponent const& component) {
                 
@@ -1,5 +1,6 @@
 #pragma once
 #include "storm/modelchecker/helper/infinitehorizon/SparseInfiniteHorizonHelper.h"
+#include "storm/solver/SolverSelectionOptions.h"
 
 
 namespace storm {
@@ -64,6 +65,16 @@ namespace storm {
                 
                 virtual void createDecomposition() override;
                 
+                /*!
+                 * @return the method that is used to solve nontrivial MECs with the given environment.
+                 */
+                storm::solver::LraMethod getLraMethodForMecs(Environment const& env) const;
+                
+                /*!
+                 * @return true iff the MECs are not solved via linear programming, as LP solvers may not be thread-safe.
+                 */
+                virtual bool supportsConcurrentComponentAnalysis(Environment const& env) const override;
+                
                 std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter,  ValueGetter const& actionValuesGetter, storm::storage::MaximalEndComponent const& mec);
                 
                 /*!
@@ -11,6 +11,11 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/SignalHandler.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
 #include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -25,7 +30,7 @@ namespace storm {
             namespace internal {
                 
                 template <typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
-                LraViHelper<ValueType, ComponentType, TransitionsType>::LraViHelper(ComponentType const& component, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, ValueType const& aperiodicFactor, storm::storage::BitVector const* timedStates, std::vector<ValueType> const* exitRates) : _component(component), _transitionMatrix(transitionMatrix), _timedStates(timedStates), _hasInstantStates(TransitionsType == LraViTransitionsType::DetTsNondetIs || TransitionsType == LraViTransitionsType::DetTsDetIs), _Tsx1IsCurrent(false) {
+                LraViHelper<ValueType, ComponentType, TransitionsType>::LraViHelper(ComponentType const& component, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, ValueType const& aperiodicFactor, storm::storage::BitVector const* timedStates, std::vector<ValueType> const* exitRates) : _component(component), _transitionMatrix(transitionMatrix), _timedStates(timedStates), _hasInstantStates(TransitionsType == LraViTransitionsType::DetTsNondetIs || TransitionsType == LraViTransitionsType::DetTsDetIs), _Tsx1IsCurrent(false), _parallelize(storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
                     // Run through the component and collect some data:
                     // We create two submodels, one consisting of the timed states of the component and one consisting of the instant states of the component.
                     // For this, we create a state index map that point from state indices of the input model to indices of the corresponding submodel of that state.
@@ -220,6 +225,7 @@ namespace storm {
                     // Set-up new iteration vectors for timed states
                     _Tsx1.assign(_TsTransitions.getRowGroupCount(), storm::utility::zero<ValueType>());
                     _Tsx2 = _Tsx1;
+                    _diffBounds = DiffBounds();
                     
                     if (_hasInstantStates) {
                         // Set-up vectors for storing intermediate results for instant states.
@@ -230,7 +236,6 @@ namespace storm {
                 
                 template <typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
                 void LraViHelper<ValueType, ComponentType, TransitionsType>::prepareSolversAndMultipliers(const Environment& env, storm::solver::OptimizationDirection const* dir) {
-                    _TsMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, _TsTransitions);
                     if (_hasInstantStates) {
                         if (_IsTransitions.getNonzeroEntryCount() > 0) {
                             // Set-up a solver for transitions within instant states
@@ -290,8 +295,7 @@ namespace storm {
                             }
                         }
                         
-                        // Set up multipliers for transitions connecting timed and instant states
-                        _TsToIsMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, _TsToIsTransitions);
+                        // Set up a multiplier for transitions from instant to timed states. Transitions from timed to instant states are considered while updating the timed states.
                         _IsToTsMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, _IsToTsTransitions);
                     }
                 }
@@ -318,36 +322,14 @@ namespace storm {
                 template <typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
                 void LraViHelper<ValueType, ComponentType, TransitionsType>::performIterationStep(Environment const& env, storm::solver::OptimizationDirection const* dir, std::vector<uint64_t>* choices) {
                     STORM_LOG_ASSERT(!((nondetTs() || nondetIs()) && dir == nullptr), "No optimization direction provided for model with nondeterminism");
-                    // Initialize value vectors, multiplers, and solver if this has not been done, yet
-                    if (!_TsMultiplier) {
+                    // Initialize the solver and multipliers for the instant states if this has not been done, yet
+                    if (_hasInstantStates && !_IsToTsMultiplier) {
                         prepareSolversAndMultipliers(env, dir);
                     }
                     
-                    // Compute new x values for the timed states
-                    // Flip what is new and what is old
-                    _Tsx1IsCurrent = !_Tsx1IsCurrent;
-                    // At this point, xOld() points to what has been computed in the most recent call of performIterationStep (initially, this is the 0-vector).
-                    // The result of this ongoing computation will be stored in xNew()
-                    
-                    // Compute the values obtained by a single uniformization step between timed states only
-                    if (nondetTs()) {
-                        if (choices == nullptr) {
-                            _TsMultiplier->multiplyAndReduce(env, *dir, xOld(), &_TsChoiceValues, xNew());
-                        } else {
-                            // Also keep track of the choices made.
-                            std::vector<uint64_t> tsChoices(_TsTransitions.getRowGroupCount());
-                            _TsMultiplier->multiplyAndReduce(env, *dir, xOld(), &_TsChoiceValues, xNew(), &tsChoices);
-                            // Note that nondeterminism within the timed states means that there can not be instant states (We either have MDPs or MAs)
-                            // Hence, in this branch we don't have to care for choices at instant states.
-                            STORM_LOG_ASSERT(!_hasInstantStates, "Nondeterministic timed states are only supported if there are no instant states.");
-                            setInputModelChoices(*choices, tsChoices);
-                        }
-                    } else {
-                        _TsMultiplier->multiply(env, xOld(), &_TsChoiceValues, xNew());
-                    }
                     if (_hasInstantStates) {
-                        // Add the values obtained by taking a single uniformization step that leads to an instant state followed by arbitrarily many instant steps.
-                        // First compute the total values when taking arbitrarily many instant transitions (in no time)
+                        // Compute the total values when taking arbitrarily many instant transitions (in no time).
+                        // The right-hand side _Isb only depends on the values of the timed states of the previous iteration, so this can be done before the values of the timed states are updated.
                         if (_NondetIsSolver) {
                             // We might need to track the optimal choices.
                             if (choices == nullptr) {
@@ -380,44 +362,128 @@ namespace storm {
                                 }
                             }
                         }
-                        // Now add the (weighted) values of the instant states to the values of the timed states.
-                        _TsToIsMultiplier->multiply(env, _Isx, &xNew(), xNew());
+                    }
+                    
+                    // Compute new x values for the timed states
+                    // Flip what is new and what is old
+                    _Tsx1IsCurrent = !_Tsx1IsCurrent;
+                    // At this point, xOld() points to what has been computed in the most recent call of performIterationStep (initially, this is the 0-vector).
+                    // The result of this ongoing computation will be stored in xNew()
+                    
+                    // To avoid large (and numerically unstable) x-values, we substract a reference value.
+                    // As each row of the timed transitions (together with the transitions to instant states) sums up to one, this can be done while computing the new values.
+                    ValueType referenceValue = xOld().front();
+                    std::unique_ptr<std::vector<uint64_t>> tsChoices;
+                    if (nondetTs() && choices != nullptr) {
+                        // Note that nondeterminism within the timed states means that there can not be instant states (We either have MDPs or MAs)
+                        // Hence, we don't have to care for choices at instant states.
+                        STORM_LOG_ASSERT(!_hasInstantStates, "Nondeterministic timed states are only supported if there are no instant states.");
+                        tsChoices = std::make_unique<std::vector<uint64_t>>(_TsTransitions.getRowGroupCount());
+                    }
+                    uint64_t numberOfTimedStates = xNew().size();
+#ifdef STORM_HAVE_INTELTBB
+                    if (_parallelize) {
+                        _diffBounds = tbb::parallel_reduce(tbb::blocked_range<uint64_t>(0, numberOfTimedStates, 100), DiffBounds(),
+                                                           [&] (tbb::blocked_range<uint64_t> const& range, DiffBounds const& bounds) { return combineDiffBounds(bounds, performTimedStep(range.begin(), range.end(), referenceValue, dir, tsChoices.get())); },
+                                                           [] (DiffBounds const& lhs, DiffBounds const& rhs) { return combineDiffBounds(lhs, rhs); });
+                    } else {
+                        _diffBounds = performTimedStep(0, numberOfTimedStates, referenceValue, dir, tsChoices.get());
+                    }
+#else
+                    _diffBounds = performTimedStep(0, numberOfTimedStates, referenceValue, dir, tsChoices.get());
+#endif
+                    if (tsChoices) {
+                        setInputModelChoices(*choices, *tsChoices);
                     }
                 }
                 
+                template <typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
+                typename LraViHelper<ValueType, ComponentType, TransitionsType>::DiffBounds LraViHelper<ValueType, ComponentType, TransitionsType>::performTimedStep(uint64_t firstState, uint64_t lastState, ValueType const& referenceValue, storm::solver::OptimizationDirection const* dir, std::vector<uint64_t>* tsChoices) {
+                    std::vector<ValueType> const& oldValues = xOld();
+                    std::vector<ValueType>& newValues = xNew();
+                    DiffBounds bounds;
+                    for (uint64_t state = firstState; state < lastState; ++state) {
+                        ValueType rowValue;
+                        if (nondetTs()) {
+                            uint64_t row = _TsTransitions.getRowGroupIndices()[state];
+                            uint64_t const rowEnd = _TsTransitions.getRowGroupIndices()[state + 1];
+                            uint64_t bestRow = row;
+                            rowValue = computeTimedRowValue(row, oldValues);
+                            for (++row; row < rowEnd; ++row) {
+                                ValueType currentValue = computeTimedRowValue(row, oldValues);
+                                if (storm::solver::minimize(*dir) ? currentValue < rowValue : currentValue > rowValue) {
+                                    rowValue = std::move(currentValue);
+                                    bestRow = row;
+                                }
+                            }
+                            if (tsChoices) {
+                                (*tsChoices)[state] = bestRow - _TsTransitions.getRowGroupIndices()[state];
+                            }
+                        } else {
+                            // The timed states are deterministic, so the row of a state coincides with its index.
+                            rowValue = computeTimedRowValue(state, oldValues);
+                        }
+                        
+                        // The old values were not reduced by the reference value, which therefore cancels out in the difference.
+                        ValueType diff = rowValue - oldValues[state];
+                        if (!bounds.isSet) {
+                            bounds.isSet = true;
+                            bounds.minDiff = diff;
+                            bounds.maxDiff = diff;
+                        } else if (diff < bounds.minDiff) {
+                            bounds.minDiff = diff;
+                        } else if (diff > bounds.maxDiff) {
+                            bounds.maxDiff = diff;
+                        }
+                        newValues[state] = rowValue - referenceValue;
+                    }
+                    return bounds;
+                }
+                
+                template <typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
+                ValueType LraViHelper<ValueType, ComponentType, TransitionsType>::computeTimedRowValue(uint64_t row, std::vector<ValueType> const& oldValues) const {
+                    ValueType result = _TsChoiceValues[row];
+                    for (auto const& entry : _TsTransitions.getRow(row)) {
+                        result += entry.getValue() * oldValues[entry.getColumn()];
+                    }
+                    if (_hasInstantStates) {
+                        // Add the values obtained by taking a single uniformization step that leads to an instant state followed by arbitrarily many instant steps.
+                        for (auto const& entry : _TsToIsTransitions.getRow(row)) {
+                            result += entry.getValue() * _Isx[entry.getColumn()];
+                        }
+                    }
+                    return result;
+                }
+                
+                template <typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
+                typename LraViHelper<ValueType, ComponentType, TransitionsType>::DiffBounds LraViHelper<ValueType, ComponentType, TransitionsType>::combineDiffBounds(DiffBounds const& lhs, DiffBounds const& rhs) {
+                    if (!lhs.isSet) {
+                        return rhs;
+                    } else if (!rhs.isSet) {
+                        return lhs;
+                    }
+                    DiffBounds result;
+                    result.isSet = true;
+                    result.minDiff = std::min(lhs.minDiff, rhs.minDiff);
+                    result.maxDiff = std::max(lhs.maxDiff, rhs.maxDiff);
+                    return result;
+                }
+                
                 template <typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
                 typename LraViHelper<ValueType, ComponentType, TransitionsType>::ConvergenceCheckResult LraViHelper<ValueType, ComponentType, TransitionsType>::checkConvergence(bool relative, ValueType precision) const {
-                    STORM_LOG_ASSERT(_TsMultiplier, "tried to check for convergence without doing an iteration first.");
+                    STORM_LOG_ASSERT(_diffBounds.isSet, "tried to check for convergence without doing an iteration first.");
                     // All values are scaled according to the uniformizationRate.
                     // We need to 'revert' this scaling when computing the absolute precision.
                     // However, for relative precision, the scaling cancels out.
                     ValueType threshold = relative ? precision : ValueType(precision / _uniformizationRate);
+                    STORM_LOG_ASSERT(threshold > storm::utility::zero<ValueType>(), "Did not expect a non-positive threshold.");
                     
+                    // The bounds on the differences between the current and the previous values have been computed along with the current values.
+                    ValueType const& maxDiff = _diffBounds.maxDiff;
+                    ValueType const& minDiff = _diffBounds.minDiff;
                     ConvergenceCheckResult res = { true, storm::utility::one<ValueType>() };
-                    // Now check whether the currently produced results are precise enough
-                    STORM_LOG_ASSERT(threshold > storm::utility::zero<ValueType>(), "Did not expect a non-positive threshold.");
-                    auto x1It = xOld().begin();
-                    auto x1Ite = xOld().end();
-                    auto x2It = xNew().begin();
-                    ValueType maxDiff = (*x2It - *x1It);
-                    ValueType minDiff = maxDiff;
-                    // The difference between maxDiff and minDiff is zero at this point. Thus, it doesn't make sense to check the threshold now.
-                    for (++x1It, ++x2It; x1It != x1Ite; ++x1It, ++x2It) {
-                        ValueType diff = (*x2It - *x1It);
-                        // Potentially update maxDiff or minDiff
-                        bool skipCheck = false;
-                        if (maxDiff < diff) {
-                            maxDiff = diff;
-                        } else if (minDiff > diff) {
-                            minDiff = diff;
-                        } else {
-                            skipCheck = true;
-                        }
-                        // Check convergence
-                        if (!skipCheck && (maxDiff - minDiff) > (relative ? (threshold * minDiff) : threshold)) {
-                            res.isPrecisionAchieved = false;
-                            break;
-                        }
+                    if ((maxDiff - minDiff) > (relative ? (threshold * minDiff) : threshold)) {
+                        res.isPrecisionAchieved = false;
                     }
                     
                     // Compute the average of the maximal and the minimal difference.
@@ -430,9 +496,6 @@ namespace storm {
                 
                 template <typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
                 void LraViHelper<ValueType, ComponentType, TransitionsType>::prepareNextIteration(Environment const& env) {
-                    // To avoid large (and numerically unstable) x-values, we substract a reference value.
-                    ValueType referenceValue = xNew().front();
-                    storm::utility::vector::applyPointwise<ValueType, ValueType>(xNew(), xNew(), [&referenceValue] (ValueType const& x_i) -> ValueType { return x_i - referenceValue; });
                     if (_hasInstantStates) {
                         // Update the RHS of the equation system for the instant states by taking the new values of timed states into account.
                         STORM_LOG_ASSERT(!nondetTs(), "Nondeterministic timed states not expected when there are also instant states.");
@@ -90,6 +90,27 @@ namespace storm {
                     */
                     void performIterationStep(Environment const& env, storm::solver::OptimizationDirection const* dir = nullptr, std::vector<uint64_t>* choices = nullptr);
                     
+                    /// Bounds on the differences between the new and the old values of the timed states.
+                    struct DiffBounds {
+                        bool isSet = false;
+                        ValueType minDiff;
+                        ValueType maxDiff;
+                    };
+                    
+                    /*!
+                     * Computes the new values of the given range of timed states in a single pass that considers the transitions to timed and instant states at once.
+                     * The given reference value is subtracted from the new values.
+                     * @param tsChoices If given, the optimal (local) choices of the timed states are inserted.
+                     * @pre the values of the instant states have been computed for the current iteration.
+                     * @return Bounds on the differences between the new values (before subtracting the reference value) and the old values in the given range.
+                     */
+                    DiffBounds performTimedStep(uint64_t firstState, uint64_t lastState, ValueType const& referenceValue, storm::solver::OptimizationDirection const* dir, std::vector<uint64_t>* tsChoices);
+                    
+                    /// Returns the value of the given row of the timed transitions for the given values of the timed states and the current values of the instant states.
+                    ValueType computeTimedRowValue(uint64_t row, std::vector<ValueType> const& oldValues) const;
+                    
+                    static DiffBounds combineDiffBounds(DiffBounds const& lhs, DiffBounds const& rhs);
+                    
                     struct ConvergenceCheckResult {
                         bool isPrecisionAchieved;
                         ValueType currentValue;
@@ -138,7 +159,9 @@ namespace storm {
                     std::vector<ValueType> _Tsx1, _Tsx2, _TsChoiceValues;
                     bool _Tsx1IsCurrent;
                     std::vector<ValueType> _Isx, _Isb, _IsChoiceValues;
-                    std::unique_ptr<storm::solver::Multiplier<ValueType>> _TsMultiplier, _TsToIsMultiplier, _IsToTsMultiplier;
+                    DiffBounds _diffBounds;
+                    bool _parallelize; // Whether the timed states are updated by multiple threads
+                    std::unique_ptr<storm::solver::Multiplier<ValueType>> _IsToTsMultiplier;
                     std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> _NondetIsSolver;
                     std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> _DetIsSolver;
                     std::unique_ptr<storm::Environment> _IsSolverEnv;
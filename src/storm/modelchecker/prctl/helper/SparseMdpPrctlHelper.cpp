@@ -554,7 +554,7 @@ namespace storm {
                 storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
                 if (doDecomposition) {
                     // Compute the states that are in MECs.
-                    endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates);
+                    endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates, storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet());
                 }
                 
                 // Only do more work if there are actually end-components.
@@ -1029,7 +1029,7 @@ namespace storm {
                 storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
                 if (doDecomposition) {
                     // Then compute the states that are in MECs with zero reward.
-                    endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates, zeroRewardChoices);
+                    endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates, zeroRewardChoices, storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet());
                 }
                 
                 // Only do more work if there are actually end-components.
@@ -19,6 +19,12 @@ namespace storm {
             // Intentionally left empty.
         }
         
+        template<storm::dd::DdType Type, typename ValueType>
+        HybridQuantitativeCheckResult<Type, ValueType>::HybridQuantitativeCheckResult(storm::dd::Bdd<Type> const& reachableStates, storm::dd::Bdd<Type> const& symbolicStates, storm::dd::Add<Type, ValueType> const& symbolicValues, storm::dd::Bdd<Type> const& explicitStates, storm::dd::Odd&& odd, std::vector<ValueType>&& explicitValues) : reachableStates(reachableStates), symbolicStates(symbolicStates), symbolicValues(symbolicValues), explicitStates(explicitStates), odd(std::move(odd)), explicitValues(std::move(explicitValues)) {
+            
+            // Intentionally left empty.
+        }
+        
         template<storm::dd::DdType Type, typename ValueType>
         std::unique_ptr<CheckResult> HybridQuantitativeCheckResult<Type, ValueType>::clone() const {
             return std::make_unique<HybridQuantitativeCheckResult<Type, ValueType>>(this->reachableStates, this->symbolicStates, this->symbolicValues, this->explicitStates, this->odd, this->explicitValues);
@@ -29,7 +35,9 @@ namespace storm {
             storm::dd::Bdd<Type> symbolicResult = symbolicStates;
             
             // First compute the symbolic part of the result.
-            if (comparisonType == storm::logic::ComparisonType::Less) {
+            if (symbolicStates.isZero()) {
+                // Nothing to do.
+            } else if (comparisonType == storm::logic::ComparisonType::Less) {
                 symbolicResult &= symbolicValues.less(bound);
             } else if (comparisonType == storm::logic::ComparisonType::LessEqual) {
                 symbolicResult &= symbolicValues.lessOrEqual(bound);
@@ -40,18 +48,36 @@ namespace storm {
             }
             
             // Then translate the explicit part to a symbolic format and simultaneously to a qualitative result.
-            symbolicResult |= storm::dd::Bdd<Type>::template fromVector<ValueType>(this->reachableStates.getDdManager(), this->explicitValues, this->odd, this->symbolicValues.getContainedMetaVariables(), comparisonType, storm::utility::convertNumber<ValueType>(bound));
+            if (!explicitStates.isZero()) {
+                symbolicResult |= storm::dd::Bdd<Type>::template fromVector<ValueType>(this->reachableStates.getDdManager(), this->explicitValues, this->odd, this->symbolicValues.getContainedMetaVariables(), comparisonType, storm::utility::convertNumber<ValueType>(bound));
+            }
             
             return std::unique_ptr<SymbolicQualitativeCheckResult<Type>>(new SymbolicQualitativeCheckResult<Type>(reachableStates, symbolicResult));
         }
         
         template<storm::dd::DdType Type, typename ValueType>
         std::unique_ptr<CheckResult> HybridQuantitativeCheckResult<Type, ValueType>::toExplicitQuantitativeCheckResult() const {
+            // If all values are stored explicitly, they are already ordered according to the ODD of all states.
+            if (symbolicStates.isZero()) {
+                return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(this->explicitValues));
+            }
+            
             storm::dd::Bdd<Type> allStates = symbolicStates || explicitStates;
-            storm::dd::Odd allStatesOdd = allStates.createOdd();
+            return toExplicitQuantitativeCheckResult(allStates.createOdd());
+        }
+        
+        template<storm::dd::DdType Type, typename ValueType>
+        std::unique_ptr<CheckResult> HybridQuantitativeCheckResult<Type, ValueType>::toExplicitQuantitativeCheckResult(storm::dd::Odd const& allStatesOdd) const {
+            STORM_LOG_ASSERT(allStatesOdd.getTotalOffset() == (symbolicStates || explicitStates).getNonZeroCount(), "ODD does not match the states of the result.");
+            
+            if (symbolicStates.isZero()) {
+                return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(this->explicitValues));
+            }
             
             std::vector<ValueType> fullExplicitValues = symbolicValues.toVector(allStatesOdd);
-            this->odd.expandExplicitVector(allStatesOdd, this->explicitValues, fullExplicitValues);
+            if (!explicitStates.isZero()) {
+                this->odd.expandExplicitVector(allStatesOdd, this->explicitValues, fullExplicitValues);
+            }
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(fullExplicitValues)));
         }
         
@@ -200,20 +226,25 @@ namespace storm {
         void HybridQuantitativeCheckResult<Type, ValueType>::filter(QualitativeCheckResult const& filter) {
             STORM_LOG_THROW(filter.isSymbolicQualitativeCheckResult(), storm::exceptions::InvalidOperationException, "Cannot filter hybrid check result with non-symbolic filter.");
             
-            // First, we filter the symbolic values.
-            this->symbolicStates = this->symbolicStates && filter.asSymbolicQualitativeCheckResult<Type>().getTruthValuesVector();
-            this->symbolicValues *= symbolicStates.template toAdd<ValueType>();
-            
-            // Next, we filter the explicit values.
-
-            // Start by computing the new set of states that is stored explictly and the corresponding ODD.
-            this->explicitStates = this->explicitStates && filter.asSymbolicQualitativeCheckResult<Type>().getTruthValuesVector();
-            storm::dd::Odd newOdd = explicitStates.createOdd();
+            storm::dd::Bdd<Type> const& filterTruthValues = filter.asSymbolicQualitativeCheckResult<Type>().getTruthValuesVector();
             
-            // Then compute the new vector of explicit values and set the new data fields.
-            this->explicitValues = explicitStates.filterExplicitVector(this->odd, explicitValues);
+            // First, we filter the symbolic values. If the filter does not remove any states, we can skip this.
+            storm::dd::Bdd<Type> newSymbolicStates = this->symbolicStates && filterTruthValues;
+            if (newSymbolicStates != this->symbolicStates) {
+                this->symbolicStates = newSymbolicStates;
+                this->symbolicValues *= symbolicStates.template toAdd<ValueType>();
+            }
             
-            this->odd = newOdd;
+            // Next, we filter the explicit values. Again, this is only necessary if the filter removes states, because
+            // the ODD and the explicit values are otherwise unaffected.
+            storm::dd::Bdd<Type> newExplicitStates = this->explicitStates && filterTruthValues;
+            if (newExplicitStates != this->explicitStates) {
+                // Start by computing the new vector of explicit values and only then replace the set of states that
+                // is stored explicitly and the corresponding ODD.
+                this->explicitValues = newExplicitStates.filterExplicitVector(this->odd, explicitValues);
+                this->explicitStates = newExplicitStates;
+                this->odd = explicitStates.createOdd();
+            }
         }
         
         template<storm::dd::DdType Type, typename ValueType>
@@ -15,6 +15,7 @@ namespace storm {
         public:
             HybridQuantitativeCheckResult() = default;
             HybridQuantitativeCheckResult(storm::dd::Bdd<Type> const& reachableStates, storm::dd::Bdd<Type> const& symbolicStates, storm::dd::Add<Type, ValueType> const& symbolicValues, storm::dd::Bdd<Type> const& explicitStates, storm::dd::Odd const& odd, std::vector<ValueType> const& explicitValues);
+            HybridQuantitativeCheckResult(storm::dd::Bdd<Type> const& reachableStates, storm::dd::Bdd<Type> const& symbolicStates, storm::dd::Add<Type, ValueType> const& symbolicValues, storm::dd::Bdd<Type> const& explicitStates, storm::dd::Odd&& odd, std::vector<ValueType>&& explicitValues);
             
             HybridQuantitativeCheckResult(HybridQuantitativeCheckResult const& other) = default;
             HybridQuantitativeCheckResult& operator=(HybridQuantitativeCheckResult const& other) = default;
@@ -29,6 +30,13 @@ namespace storm {
             
             std::unique_ptr<CheckResult> toExplicitQuantitativeCheckResult() const;
             
+            /*!
+             * Converts the result to an explicit result whose values are ordered according to the given ODD. The ODD
+             * must have been created for the set of all states that this result has values for. This avoids
+             * recomputing the ODD if the caller already has it at hand.
+             */
+            std::unique_ptr<CheckResult> toExplicitQuantitativeCheckResult(storm::dd::Odd const& allStatesOdd) const;
+            
             virtual bool isHybrid() const override;
             virtual bool isResultForAllStates() const override;
             
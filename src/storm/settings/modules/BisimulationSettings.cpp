@@ -49,7 +49,7 @@ namespace storm {
                                              .setDefaultValueString("finer").build())
                                 .build());
                 
-                std::vector<std::string> refinementModes = {"full", "changed"};
+                std::vector<std::string> refinementModes = {"full", "changed", "dirty"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, refinementModeOptionName, true, "Sets which refinement mode to use.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementModes))
                                              .setDefaultValueString("full").build())
@@ -131,6 +131,8 @@ namespace storm {
                     return RefinementMode::Full;
                 } else if (refinementModeAsString == "changed") {
                     return RefinementMode::ChangedStates;
+                } else if (refinementModeAsString == "dirty") {
+                    return RefinementMode::DirtyBlocks;
                 }
                 return RefinementMode::Full;
             }
@@ -22,7 +22,7 @@ namespace storm {
                 
                 enum class InitialPartitionMode { Regular, Finer };
                 
-                enum class RefinementMode { Full, ChangedStates };
+                enum class RefinementMode { Full, ChangedStates, DirtyBlocks };
                 
                 /*!
                  * Creates a new set of bisimulation settings.
@@ -36,6 +36,11 @@ namespace storm {
             const std::string buildOutOfBoundsStateOptionName = "build-out-of-bounds-state";
             const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
             const std::string bitsForUnboundedVariablesOptionName = "int-bits";
+            const std::string spillStatesOptionName = "spillstates";
+            const std::string explorationThreadsOptionName = "explthreads";
+            const std::string rewardThreadsOptionName = "rewardthreads";
+            const std::string partialOrderReductionOptionName = "por";
+            const std::string symmetryReductionOptionName = "symmetry";
 
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
@@ -57,6 +62,16 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOverlappingGuardsLabelOptionName, false, "For states where multiple guards are enabled, we add a label (for debugging DTMCs)").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false, "Sets the number of bits that is used for unbounded integer variables.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorExcluding(0,63)).setDefaultValueUnsignedInteger(32).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false, "If set, partial-order reduction is applied when exploring MDPs given as PRISM programs (explicit engine only).").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false, "If set, states that only differ by a permutation of symmetric modules of a PRISM program are merged (explicit engine only).").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, spillStatesOptionName, false, "If set, explored states are spilled to disk once too many of them are held in memory (explicit engine only).").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory in which the spilled states are stored.").build())
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threshold", "The number of states that are held in memory before spilling them.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).setDefaultValueUnsignedInteger(50000000).makeOptional().build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false, "Sets the number of threads that expand states (explicit engine only). The successors of a batch of states are computed in parallel while the results of the previous batch are added to the model.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).setDefaultValueUnsignedInteger(1).build())
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("batchsize", "The number of states per batch.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).setDefaultValueUnsignedInteger(1024).makeOptional().build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, rewardThreadsOptionName, false, "If set, the state rewards are computed in a separate pass after the exploration of a PRISM program using the given number of threads (explicit engine only).").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).setDefaultValueUnsignedInteger(1).build()).build());
             }
 
             bool BuildSettings::isExplorationOrderSet() const {
@@ -129,6 +144,42 @@ namespace storm {
                 return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
             }
 
+            bool BuildSettings::isPartialOrderReductionSet() const {
+                return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isSymmetryReductionSet() const {
+                return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isSpillStatesSet() const {
+                return this->getOption(spillStatesOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getSpillStatesDirectory() const {
+                return this->getOption(spillStatesOptionName).getArgumentByName("dir").getValueAsString();
+            }
+
+            uint64_t BuildSettings::getSpillStatesThreshold() const {
+                return this->getOption(spillStatesOptionName).getArgumentByName("threshold").getValueAsUnsignedInteger();
+            }
+
+            uint64_t BuildSettings::getExplorationThreads() const {
+                return this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
+            uint64_t BuildSettings::getExplorationBatchSize() const {
+                return this->getOption(explorationThreadsOptionName).getArgumentByName("batchsize").getValueAsUnsignedInteger();
+            }
+
+            bool BuildSettings::isRewardThreadsSet() const {
+                return this->getOption(rewardThreadsOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t BuildSettings::getRewardThreads() const {
+                return this->getOption(rewardThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
         }
 
 
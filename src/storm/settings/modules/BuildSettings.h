@@ -116,6 +116,51 @@ namespace storm {
                  */
                 uint64_t getBitsForUnboundedVariables() const;
 
+                /*!
+                 * Retrieves whether partial-order reduction is to be applied.
+                 */
+                bool isPartialOrderReductionSet() const;
+
+                /*!
+                 * Retrieves whether symmetry reduction is to be applied.
+                 */
+                bool isSymmetryReductionSet() const;
+
+                /*!
+                 * Retrieves whether explored states are to be spilled to disk.
+                 */
+                bool isSpillStatesSet() const;
+
+                /*!
+                 * Retrieves the directory in which spilled states are stored.
+                 */
+                std::string getSpillStatesDirectory() const;
+
+                /*!
+                 * Retrieves the number of states that are held in memory before they are spilled to disk.
+                 */
+                uint64_t getSpillStatesThreshold() const;
+
+                /*!
+                 * Retrieves the number of threads that expand states during explicit model building.
+                 */
+                uint64_t getExplorationThreads() const;
+
+                /*!
+                 * Retrieves the number of states that are expanded in one batch if multiple threads are used.
+                 */
+                uint64_t getExplorationBatchSize() const;
+
+                /*!
+                 * Retrieves whether the state rewards are to be computed in a separate pass after the exploration.
+                 */
+                bool isRewardThreadsSet() const;
+
+                /*!
+                 * Retrieves the number of threads that compute the state rewards after the exploration.
+                 */
+                uint64_t getRewardThreads() const;
+
 
                 // The name of the module.
                 static const std::string moduleName;
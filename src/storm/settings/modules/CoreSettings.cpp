@@ -27,6 +27,7 @@ namespace storm {
             const std::string CoreSettings::statisticsOptionShortName = "stats";
             const std::string CoreSettings::engineOptionName = "engine";
             const std::string CoreSettings::engineOptionShortName = "e";
+            const std::string CoreSettings::engineFallbackOptionName = "engine-fallback";
             const std::string CoreSettings::ddLibraryOptionName = "ddlib";
             const std::string CoreSettings::cudaOptionName = "cuda";
             const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
@@ -41,6 +42,7 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, engineOptionName, false, "Sets which engine is used for model building and model checking.").setShortName(engineOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the engine to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(engines)).setDefaultValueString("sparse").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, engineFallbackOptionName, false, "If set, the dd engine falls back to the hybrid engine and the hybrid engine falls back to the sparse engine whenever the memory budget of the DD library (see the budget options of the DD libraries) is exceeded.").setIsAdvanced().build());
                 
                 std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination", "topological", "acyclic"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, eqSolverOptionName, false, "Sets which solver is preferred for solving systems of linear equations.")
@@ -140,6 +142,10 @@ namespace storm {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
             }
             
+            bool CoreSettings::isEngineFallbackSet() const {
+                return this->getOption(engineFallbackOptionName).getHasOptionBeenSet();
+            }
+
             storm::utility::Engine CoreSettings::getEngine() const {
                 return engine;
             }
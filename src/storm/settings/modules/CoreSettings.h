@@ -110,6 +110,14 @@ namespace storm {
                  */
                 bool isUseCudaSet() const;
 
+                /*!
+                 * Retrieves whether the engine may fall back to a less memory-intensive one (dd to hybrid, hybrid to
+                 * sparse) if the DD library exceeds its memory budget.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isEngineFallbackSet() const;
+
                 /*!
                  * Retrieves the selected engine.
                  *
@@ -139,6 +147,7 @@ namespace storm {
                 static const std::string statisticsOptionShortName;
                 static const std::string engineOptionName;
                 static const std::string engineOptionShortName;
+                static const std::string engineFallbackOptionName;
                 static const std::string ddLibraryOptionName;
                 static const std::string intelTbbOptionName;
                 static const std::string intelTbbOptionShortName;
@@ -17,6 +17,7 @@ namespace storm {
             const std::string CuddSettings::moduleName = "cudd";
             const std::string CuddSettings::precisionOptionName = "precision";
             const std::string CuddSettings::maximalMemoryOptionName = "maxmem";
+            const std::string CuddSettings::memoryBudgetOptionName = "budget";
             const std::string CuddSettings::reorderOptionName = "dynreorder";
             const std::string CuddSettings::reorderTechniqueOptionName = "reordertechnique";
             
@@ -25,6 +26,8 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Cudd in MB.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory available to Cudd (0 means unlimited).").setDefaultValueUnsignedInteger(4096).build()).build());
 
+                this->addOption(storm::settings::OptionBuilder(moduleName, memoryBudgetOptionName, true, "Sets the fraction of the maximal memory that Cudd may occupy before its memory budget is considered to be exceeded.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The fraction of the maximal memory (0 means no budget).").setDefaultValueDouble(0.0).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0.0, 1.0)).build()).build());
+
                 this->addOption(storm::settings::OptionBuilder(moduleName, reorderOptionName, false, "Sets whether dynamic reordering is allowed.").setIsAdvanced().build());
                 
                 std::vector<std::string> reorderingTechniques;
@@ -57,6 +60,10 @@ namespace storm {
                 return this->getOption(maximalMemoryOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
             
+            double CuddSettings::getMemoryBudget() const {
+                return this->getOption(memoryBudgetOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
             bool CuddSettings::isReorderingEnabled() const {
                 return this->getOption(reorderOptionName).getHasOptionBeenSet();
             }
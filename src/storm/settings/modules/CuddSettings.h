@@ -34,6 +34,14 @@ namespace storm {
                  */
                 uint_fast64_t getMaximalMemory() const;
                 
+                /*!
+                 * Retrieves the fraction of the maximal memory that CUDD may occupy before its memory budget is
+                 * considered to be exceeded.
+                 *
+                 * @return The fraction of the maximal memory constituting the budget.
+                 */
+                double getMemoryBudget() const;
+                
                 /*!
                  * Retrieves whether dynamic reordering is enabled.
                  *
@@ -55,6 +63,7 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string precisionOptionName;
                 static const std::string maximalMemoryOptionName;
+                static const std::string memoryBudgetOptionName;
                 static const std::string reorderOptionName;
                 static const std::string reorderTechniqueOptionName;
             };
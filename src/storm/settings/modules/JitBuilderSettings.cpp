@@ -21,6 +21,7 @@ namespace storm {
             const std::string JitBuilderSettings::carlIncludeDirectoryOptionName = "carl";
             const std::string JitBuilderSettings::compilerFlagsOptionName = "cxxflags";
             const std::string JitBuilderSettings::optimizationLevelOptionName = "opt";
+            const std::string JitBuilderSettings::cacheDirectoryOptionName = "cache";
 
             JitBuilderSettings::JitBuilderSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, doctorOptionName, false, "Show debugging information on why the jit-based model builder is not working on your system.").setIsAdvanced().build());
@@ -36,6 +37,8 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("flags", "The compiler flags.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, optimizationLevelOptionName, false, "Sets the optimization level.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("level", "The level to use.").setDefaultValueUnsignedInteger(3).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheDirectoryOptionName, false, "Keeps the compiled model generators in the given directory and reuses them if the same model is built again.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The cache directory.").build()).build());
             }
             
             bool JitBuilderSettings::isCompilerSet() const {
@@ -86,6 +89,14 @@ namespace storm {
                 return this->getOption(optimizationLevelOptionName).getArgumentByName("level").getValueAsUnsignedInteger();
             }
             
+            bool JitBuilderSettings::isCacheDirectorySet() const {
+                return this->getOption(cacheDirectoryOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string JitBuilderSettings::getCacheDirectory() const {
+                return this->getOption(cacheDirectoryOptionName).getArgumentByName("dir").getValueAsString();
+            }
+            
             void JitBuilderSettings::finalize() {
                 // Intentionally left empty.
             }
@@ -19,6 +19,7 @@ namespace storm {
             const std::string LongRunAverageSolverSettings::precisionOptionName = "precision";
             const std::string LongRunAverageSolverSettings::absoluteOptionName = "absolute";
             const std::string LongRunAverageSolverSettings::aperiodicFactorOptionName = "aperiodicfactor";
+            const std::string LongRunAverageSolverSettings::threadsOptionName = "threads";
 
             LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(moduleName) {
                 
@@ -38,6 +39,9 @@ namespace storm {
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, aperiodicFactorOptionName, true, "If required by the selected method (e.g. vi), this factor controls how the system is made aperiodic").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The factor.").setDefaultValueDouble(0.125).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads that compute the long run averages of different end components concurrently. Only applies to floating-point computations.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).setDefaultValueUnsignedInteger(1).build()).build());
+                
             }
             
             storm::solver::LraMethod LongRunAverageSolverSettings::getDetLraMethod() const {
@@ -96,6 +100,10 @@ namespace storm {
                 return this->getOption(aperiodicFactorOptionName).getArgumentByName("value").getValueAsDouble();
             }
             
+            uint64_t LongRunAverageSolverSettings::getNumberOfThreads() const {
+                return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
         }
     }
 }
@@ -74,6 +74,11 @@ namespace storm {
                  */
                 double getAperiodicFactor() const;
                 
+                /*!
+                 * Retrieves the number of threads that compute the long run averages of different components concurrently.
+                 */
+                uint64_t getNumberOfThreads() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -85,6 +90,7 @@ namespace storm {
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
                 static const std::string aperiodicFactorOptionName;
+                static const std::string threadsOptionName;
             };
             
         }
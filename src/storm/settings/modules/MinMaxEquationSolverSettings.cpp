@@ -19,9 +19,12 @@ namespace storm {
             const std::string MinMaxEquationSolverSettings::absoluteOptionName = "absolute";
             const std::string MinMaxEquationSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
             const std::string MinMaxEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+            const std::string MinMaxEquationSolverSettings::modifiedPolicyIterationStepsOptionName = "mpisteps";
+            const std::string MinMaxEquationSolverSettings::prioritizedValueIterationOptionName = "prioritized";
+            const std::string MinMaxEquationSolverSettings::mixedPrecisionOptionName = "mixedprecision";
 
             MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi", "acyclic"};
+                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi", "acyclic", "mpi", "modified-policy-iteration"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a min/max linear equation solving technique.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(minMaxSolvingTechniques)).setDefaultValueString("topological").build()).build());
                 
@@ -37,6 +40,14 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, intervalIterationSymmetricUpdatesOptionName, false, "If set, interval iteration performs an update on both, lower and upper bound in each iteration").setIsAdvanced().build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, modifiedPolicyIterationStepsOptionName, false, "Sets the number of evaluation sweeps that modified policy iteration initially performs per policy. The number is doubled whenever the policy does not change.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of sweeps.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).setDefaultValueUnsignedInteger(10).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, prioritizedValueIterationOptionName, false, "If set, value iteration and interval iteration update the states in the order of their (estimated) residuals instead of sweeping over all states.").setIsAdvanced().build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false, "If set, value iteration and the value iterations of rational search first iterate in single precision on a compact copy of the matrix before continuing in the precision of the value type.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("threshold", "The precision up to which single precision is used.").setDefaultValueDouble(1e-04).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).makeOptional().build()).build());
+                
             }
             
             storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -61,6 +72,8 @@ namespace storm {
                     return storm::solver::MinMaxMethod::ViToPi;
                 } else if (minMaxEquationSolvingTechnique == "acyclic") {
                     return storm::solver::MinMaxMethod::Acyclic;
+                } else if (minMaxEquationSolvingTechnique == "modified-policy-iteration" || minMaxEquationSolvingTechnique == "mpi") {
+                    return storm::solver::MinMaxMethod::ModifiedPolicyIteration;
                 }
                 
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown min/max equation solving technique '" << minMaxEquationSolvingTechnique << "'.");
@@ -112,6 +125,22 @@ namespace storm {
                 return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
             }
             
+            uint64_t MinMaxEquationSolverSettings::getModifiedPolicyIterationSteps() const {
+                return this->getOption(modifiedPolicyIterationStepsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            bool MinMaxEquationSolverSettings::isPrioritizedValueIterationSet() const {
+                return this->getOption(prioritizedValueIterationOptionName).getHasOptionBeenSet();
+            }
+            
+            bool MinMaxEquationSolverSettings::isMixedPrecisionSet() const {
+                return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+            }
+            
+            double MinMaxEquationSolverSettings::getSinglePrecisionThreshold() const {
+                return this->getOption(mixedPrecisionOptionName).getArgumentByName("threshold").getValueAsDouble();
+            }
+            
         }
     }
 }
@@ -95,6 +95,26 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves the number of evaluation sweeps that modified policy iteration initially performs per policy.
+                 */
+                uint64_t getModifiedPolicyIterationSteps() const;
+                
+                /*!
+                 * Retrieves whether value iteration and interval iteration update the states in the order of their residuals.
+                 */
+                bool isPrioritizedValueIterationSet() const;
+                
+                /*!
+                 * Retrieves whether value iterations start in single precision.
+                 */
+                bool isMixedPrecisionSet() const;
+                
+                /*!
+                 * Retrieves the precision up to which value iterations are performed in single precision.
+                 */
+                double getSinglePrecisionThreshold() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -106,6 +126,9 @@ namespace storm {
                 static const std::string absoluteOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
+                static const std::string modifiedPolicyIterationStepsOptionName;
+                static const std::string prioritizedValueIterationOptionName;
+                static const std::string mixedPrecisionOptionName;
                 static const std::string forceBoundsOptionName;
             };
             
@@ -13,10 +13,12 @@ namespace storm {
             
             const std::string SylvanSettings::moduleName = "sylvan";
             const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
+            const std::string SylvanSettings::memoryBudgetOptionName = "budget";
             const std::string SylvanSettings::threadCountOptionName = "threads";
             
             SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory available to Sylvan.").setDefaultValueUnsignedInteger(4096).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, memoryBudgetOptionName, true, "Sets the fraction of the maximal unique table size that Sylvan may fill before its memory budget is considered to be exceeded.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The fraction of the maximal table size (0 means no budget).").setDefaultValueDouble(0.0).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0.0, 1.0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true, "Sets the number of threads used by Sylvan.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of threads available to Sylvan (0 means 'auto-detect').").build()).build());
             }
             
@@ -24,6 +26,10 @@ namespace storm {
                 return this->getOption(maximalMemoryOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
 
+            double SylvanSettings::getMemoryBudget() const {
+                return this->getOption(memoryBudgetOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+
             bool SylvanSettings::isNumberOfThreadsSet() const {
                 return this->getOption(threadCountOptionName).getArgumentByName("value").getHasBeenSet();
             }
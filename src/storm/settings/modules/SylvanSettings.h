@@ -24,6 +24,14 @@ namespace storm {
                  */
                 uint_fast64_t getMaximalMemory() const;
                 
+                /*!
+                 * Retrieves the fraction of the maximal unique table size that Sylvan may fill before its memory budget
+                 * is considered to be exceeded.
+                 *
+                 * @return The fraction of the maximal table size constituting the budget.
+                 */
+                double getMemoryBudget() const;
+                
                 /*!
                  * Retrieves the amount of threads available to Sylvan. Note that a value of zero means that the number
                  * of threads is auto-detected to fit the current machine.
@@ -43,6 +51,7 @@ namespace storm {
             private:
                 // Define the string names of the options as constants.
                 static const std::string maximalMemoryOptionName;
+                static const std::string memoryBudgetOptionName;
                 static const std::string threadCountOptionName;
             };
             
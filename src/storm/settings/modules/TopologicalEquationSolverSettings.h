@@ -61,6 +61,13 @@ namespace storm {
                  */
                 storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
                 
+                /*!
+                 * Retrieves the number of threads that solve independent SCCs concurrently.
+                 *
+                 * @return The number of threads.
+                 */
+                uint64_t getNumberOfThreads() const;
+                
                 bool check() const override;
                 
                 // The name of the module.
@@ -70,6 +77,7 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string underlyingEquationSolverOptionName;
                 static const std::string underlyingMinMaxMethodOptionName;
+                static const std::string threadsOptionName;
             };
             
         } // namespace modules
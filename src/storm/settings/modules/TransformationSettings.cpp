@@ -16,6 +16,7 @@ namespace storm {
             const std::string TransformationSettings::labelBehaviorOptionName = "ec-label-behavior";
             const std::string TransformationSettings::toNondetOptionName = "to-nondet";
             const std::string TransformationSettings::toDiscreteTimeOptionName = "to-discrete";
+            const std::string TransformationSettings::permuteStatesOptionName = "permute";
 
 
             TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
@@ -32,6 +33,13 @@ namespace storm {
                                 "keep").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(labelBehavior)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, toNondetOptionName, false, "If set, DTMCs/CTMCs are converted to MDPs/MAs (without actual nondeterminism) before model checking.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, toDiscreteTimeOptionName, false, "If set, CTMCs/MAs are converted to DTMCs/MDPs (which might or might not preserve the provided properties).").setIsAdvanced().build());
+                std::vector<std::string> orderKinds;
+                for (auto const& order : storm::utility::permutation::getOrderKinds()) {
+                    orderKinds.push_back(storm::utility::permutation::orderKindToString(order));
+                }
+                this->addOption(storm::settings::OptionBuilder(moduleName, permuteStatesOptionName, false, "If set, the states of sparse models are renumbered after building them, which can improve the cache locality of the solvers.").setIsAdvanced().addArgument(
+                        storm::settings::ArgumentBuilder::createStringArgument("order", "The order of the states. 'bfs' is a breadth-first search from the initial states, 'rcm' is the reverse Cuthill-McKee order and 'scc' places the states of each SCC consecutively in topological order.").setDefaultValueString(
+                                "rcm").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(orderKinds)).build()).build());
             }
 
             bool TransformationSettings::isChainEliminationSet() const {
@@ -59,6 +67,20 @@ namespace storm {
                 return this->getOption(toDiscreteTimeOptionName).getHasOptionBeenSet();
             }
 
+            bool TransformationSettings::isPermuteStatesSet() const {
+                return this->getOption(permuteStatesOptionName).getHasOptionBeenSet();
+            }
+
+            storm::utility::permutation::OrderKind TransformationSettings::getPermutationOrder() const {
+                std::string orderAsString = this->getOption(permuteStatesOptionName).getArgumentByName("order").getValueAsString();
+                for (auto const& order : storm::utility::permutation::getOrderKinds()) {
+                    if (storm::utility::permutation::orderKindToString(order) == orderAsString) {
+                        return order;
+                    }
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal value '" << orderAsString << "' set as order of the states.");
+            }
+
             bool TransformationSettings::check() const {
                 // Ensure that labeling preservation is only set if chain elimination is set
                 STORM_LOG_THROW(isChainEliminationSet() || !this->getOption(labelBehaviorOptionName).getHasOptionBeenSet(),
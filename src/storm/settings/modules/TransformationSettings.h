@@ -45,6 +45,16 @@ namespace storm {
                  */
                 bool isToDiscreteTimeModelSet() const;
 
+                /*!
+                 * Retrieves whether the states of a sparse model should be renumbered after building it.
+                 */
+                bool isPermuteStatesSet() const;
+
+                /*!
+                 * Retrieves the order in which the states should be renumbered.
+                 */
+                storm::utility::permutation::OrderKind getPermutationOrder() const;
+
                 bool check() const override;
 
                 void finalize() override;
@@ -58,6 +68,7 @@ namespace storm {
                 static const std::string labelBehaviorOptionName;
                 static const std::string toNondetOptionName;
                 static const std::string toDiscreteTimeOptionName;
+                static const std::string permuteStatesOptionName;
 
             };
 
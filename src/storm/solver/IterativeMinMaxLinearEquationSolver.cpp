@@ -6,6 +6,8 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
+#include "storm/storage/ConsecutiveUint64DynamicPriorityQueue.h"
+
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
@@ -55,7 +57,7 @@ namespace storm {
                     STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
                 }
             }
-            STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi, storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
+            STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi || method == MinMaxMethod::ModifiedPolicyIteration, storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
             return method;
         }
         
@@ -72,6 +74,9 @@ namespace storm {
                 case MinMaxMethod::PolicyIteration:
                     result = solveEquationsPolicyIteration(env, dir, x, b);
                     break;
+                case MinMaxMethod::ModifiedPolicyIteration:
+                    result = solveEquationsModifiedPolicyIteration(env, dir, x, b);
+                    break;
                 case MinMaxMethod::RationalSearch:
                     result = solveEquationsRationalSearch(env, dir, x, b);
                     break;
@@ -92,27 +97,35 @@ namespace storm {
         }
 
         template<typename ValueType>
-        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const {
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, storm::storage::SparseMatrix<ValueType>& inducedMatrix, std::vector<uint64_t> const& scheduler, std::vector<uint64_t> const* changedRowGroups, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const {
             assert(subB.size() == x.size());
             
             // Resolve the nondeterminism according to the given scheduler.
             bool convertToEquationSystem = this->linearEquationSolverFactory->getEquationProblemFormat(env) == LinearEquationSolverProblemFormat::EquationSystem;
-            storm::storage::SparseMatrix<ValueType> submatrix = this->A->selectRowsFromRowGroups(scheduler, convertToEquationSystem);
-            if (convertToEquationSystem) {
-                submatrix.convertToEquationSystem();
+            if (changedRowGroups && linearEquationSolver) {
+                // Only the rows of the changed row groups need to be replaced.
+                inducedMatrix.updateRowsFromRowGroups(*this->A, scheduler, *changedRowGroups, convertToEquationSystem, convertToEquationSystem);
+                for (auto const& rowGroup : *changedRowGroups) {
+                    subB[rowGroup] = originalB[this->A->getRowGroupIndices()[rowGroup] + scheduler[rowGroup]];
+                }
+            } else {
+                inducedMatrix = this->A->selectRowsFromRowGroups(scheduler, convertToEquationSystem);
+                if (convertToEquationSystem) {
+                    inducedMatrix.convertToEquationSystem();
+                }
+                storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, this->A->getRowGroupIndices(), originalB);
             }
-            storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, this->A->getRowGroupIndices(), originalB);
             
             // Check whether the linear equation solver is already initialized
             if (!linearEquationSolver) {
                 // Initialize the equation solver
-                linearEquationSolver = this->linearEquationSolverFactory->create(env, std::move(submatrix));
+                linearEquationSolver = this->linearEquationSolverFactory->create(env);
                 linearEquationSolver->setBoundsFromOtherSolver(*this);
                 linearEquationSolver->setCachingEnabled(true);
-            } else {
-                // If the equation solver is already initialized, it suffices to update the matrix
-                linearEquationSolver->setMatrix(std::move(submatrix));
             }
+            // The solver refers to the induced matrix (unless it converts it to another format), so the matrix itself
+            // is not copied. This also discards all data the solver derived from the previous matrix.
+            linearEquationSolver->setMatrix(inducedMatrix);
             // Solve the equation system for the 'DTMC' and return true upon success
             return linearEquationSolver->solveEquations(env, x, subB);
         }
@@ -133,7 +146,10 @@ namespace storm {
             }
             std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
 
-            // The solver that we will use throughout the procedure.
+            // The matrix induced by the current scheduler and the solver that we will use throughout the procedure.
+            // Since the scheduler typically only changes in a few states, the induced matrix is updated in place.
+            storm::storage::SparseMatrix<ValueType> inducedMatrix;
+            std::vector<uint64_t> changedRowGroups;
             std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver;
             // The linear equation solver should be at least as precise as this solver
             std::unique_ptr<storm::Environment> environmentOfSolverStorage;
@@ -161,10 +177,11 @@ namespace storm {
             this->startMeasureProgress();
             do {
                 // Solve the equation system for the 'DTMC'.
-                solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
+                solveInducedEquationSystem(environmentOfSolver, solver, inducedMatrix, scheduler, iterations == 0 ? nullptr : &changedRowGroups, x, subB, b);
                 
                 // Go through the multiplication result and see whether we can improve any of the choices.
                 bool schedulerImproved = false;
+                changedRowGroups.clear();
                 for (uint_fast64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
                     uint_fast64_t currentChoice = scheduler[group];
                     for (uint_fast64_t choice = this->A->getRowGroupIndices()[group]; choice < this->A->getRowGroupIndices()[group + 1]; ++choice) {
@@ -184,6 +201,9 @@ namespace storm {
                         // TODO: If the underlying solver is not precise, this might run forever (i.e. when a state has two choices where the (exact) values are equal).
                         // only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
                         if (valueImproved(dir, x[group], choiceValue)) {
+                            if (changedRowGroups.empty() || changedRowGroups.back() != group) {
+                                changedRowGroups.push_back(group);
+                            }
                             schedulerImproved = true;
                             scheduler[group] = choice - this->A->getRowGroupIndices()[group];
                             x[group] = std::move(choiceValue);
@@ -218,6 +238,120 @@ namespace storm {
             return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
         }
         
+        /*!
+         * Modified policy iteration (see Puterman and Shin, Modified Policy Iteration Algorithms for Discounted Markov
+         * Decision Problems, Management Science 1978). Instead of solving the equation system induced by each policy,
+         * its values are only approximated by a few Gauss-Seidel sweeps over the rows selected by the policy, starting
+         * from the current values. The sweeps operate directly on the original matrix, so switching to a new policy
+         * does not require building an induced matrix or a new linear equation solver.
+         */
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsModifiedPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->multiplierA) {
+                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+            }
+            if (!auxiliaryRowGroupVector) {
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            }
+            
+            // As for value iteration, we approach the solution from below (above) if it is not unique. The values of
+            // any policy that are approximated from below (above) stay below (above) the solution.
+            SolverGuarantee guarantee = SolverGuarantee::None;
+            if (!this->hasUniqueSolution()) {
+                if (maximize(dir)) {
+                    this->createLowerBoundsVector(x);
+                    guarantee = SolverGuarantee::LessOrEqual;
+                } else {
+                    this->createUpperBoundsVector(x);
+                    guarantee = SolverGuarantee::GreaterOrEqual;
+                }
+            } else if (this->hasCustomTerminationCondition()) {
+                if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::LessOrEqual) && this->hasLowerBound()) {
+                    this->createLowerBoundsVector(x);
+                    guarantee = SolverGuarantee::LessOrEqual;
+                } else if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::GreaterOrEqual) && this->hasUpperBound()) {
+                    this->createUpperBoundsVector(x);
+                    guarantee = SolverGuarantee::GreaterOrEqual;
+                }
+            }
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+            uint64_t maximalNumberOfIterations = env.solver().minMax().getMaximalNumberOfIterations();
+            
+            // The number of sweeps per policy is doubled as long as the policy does not change, since then the
+            // values of the policy are (almost) the solution and improving the policy does not pay off.
+            uint64_t const initialNumberOfSweeps = env.solver().minMax().getModifiedPolicyIterationSteps();
+            // The bound saturates to avoid overflows for very large numbers of steps.
+            uint64_t const maximalNumberOfSweeps = std::min(initialNumberOfSweeps, std::numeric_limits<uint64_t>::max() >> 10) << 10;
+            uint64_t numberOfSweeps = initialNumberOfSweeps;
+            
+            std::vector<uint_fast64_t> scheduler = this->hasInitialScheduler() ? this->getInitialScheduler() : std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+            std::vector<uint_fast64_t> newScheduler(this->A->getRowGroupCount());
+            std::vector<ValueType>& newX = *auxiliaryRowGroupVector;
+            
+            SolverStatus status = SolverStatus::InProgress;
+            uint64_t iterations = 0;
+            uint64_t totalNumberOfSweeps = 0;
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress) {
+                // Approximate the values of the current policy. Without an initial scheduler, there is no policy yet.
+                if (iterations > 0 || this->hasInitialScheduler()) {
+                    totalNumberOfSweeps += approximatePolicyValues(scheduler, x, b, numberOfSweeps, precision, relative);
+                }
+                
+                // Improve the policy, which is a step of value iteration.
+                this->multiplierA->multiplyAndReduce(env, dir, x, &b, newX, &newScheduler);
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(x, newX, precision, relative)) {
+                    status = SolverStatus::Converged;
+                }
+                bool policyChanged = iterations == 0 || scheduler != newScheduler;
+                std::swap(x, newX);
+                std::swap(scheduler, newScheduler);
+                numberOfSweeps = policyChanged ? initialNumberOfSweeps : 2 * std::min(numberOfSweeps, maximalNumberOfSweeps / 2);
+                
+                ++iterations;
+                status = this->updateStatus(status, x, guarantee, iterations, maximalNumberOfIterations);
+                this->showProgressIterative(iterations);
+            }
+            
+            this->reportStatus(status, iterations);
+            STORM_LOG_INFO("Modified policy iteration performed " << totalNumberOfSweeps << " evaluation sweeps in " << iterations << " policy improvements.");
+            
+            // If requested, we store the scheduler for retrieval. It is optimal for the values of the previous iteration.
+            if (this->isTrackSchedulerSet()) {
+                this->schedulerChoices = std::move(scheduler);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
+        template<typename ValueType>
+        uint64_t IterativeMinMaxLinearEquationSolver<ValueType>::approximatePolicyValues(std::vector<uint_fast64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t maximalNumberOfSweeps, ValueType const& precision, bool relative) const {
+            std::vector<uint64_t> const& rowGroupIndices = this->A->getRowGroupIndices();
+            uint64_t sweeps = 0;
+            bool converged = false;
+            while (!converged && sweeps < maximalNumberOfSweeps) {
+                // Sweep backwards as in Gauss-Seidel value iteration. We stop early if the values of the policy are reached.
+                converged = true;
+                for (uint64_t group = x.size(); group > 0; --group) {
+                    uint64_t row = rowGroupIndices[group - 1] + scheduler[group - 1];
+                    ValueType newValue = b[row];
+                    this->multiplierA->multiplyRow(row, x, newValue);
+                    if (converged && !storm::utility::vector::equalModuloPrecision<ValueType>(x[group - 1], newValue, precision, relative)) {
+                        converged = false;
+                    }
+                    x[group - 1] = std::move(newValue);
+                }
+                ++sweeps;
+            }
+            return sweeps;
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const {
             if (dir == OptimizationDirection::Minimize) {
@@ -278,6 +412,20 @@ namespace storm {
                 if (!this->hasNoEndComponents()) {
                     requirements.requireValidInitialScheduler();
                 }
+            } else if (method == MinMaxMethod::ModifiedPolicyIteration) {
+                // As the policies are only evaluated approximately, we have the same requirements as value iteration.
+                if (!this->hasUniqueSolution()) {
+                    if (this->isTrackSchedulerSet()) {
+                        requirements.requireUniqueSolution();
+                    } else {
+                        if (!direction || direction.get() == OptimizationDirection::Maximize) {
+                            requirements.requireLowerBounds();
+                        }
+                        if (!direction || direction.get() == OptimizationDirection::Minimize) {
+                            requirements.requireUpperBounds();
+                        }
+                    }
+                }
             } else if (method == MinMaxMethod::SoundValueIteration) {
                 if (!this->hasUniqueSolution()) {
                     requirements.requireUniqueSolution();
@@ -335,7 +483,207 @@ namespace storm {
             
             return ValueIterationResult(iterations - currentIterations, status);
         }
+        
+        template<typename ValueType>
+        class ResidualLess {
+        public:
+            ResidualLess(std::vector<ValueType> const& residuals) : residuals(residuals) {
+                // Intentionally left empty.
+            }
+            
+            bool operator()(uint64_t const& a, uint64_t const& b) const {
+                return residuals[a] < residuals[b];
+            }
+            
+        private:
+            std::vector<ValueType> const& residuals;
+        };
+        
+        /*!
+         * Prioritized value iteration in the spirit of prioritized sweeping (Moore and Atkeson, Prioritized Sweeping:
+         * Reinforcement Learning with Less Data and Less Time, Machine Learning 1993). Since the Bellman operator is
+         * non-expansive, updating a state by delta changes the residual of each predecessor by at most delta times the
+         * (maximal) probability to move to the state. Adding these changes gives an upper bound on the residuals, so all
+         * residuals are below the precision once the largest bound is.
+         */
+        template<typename ValueType>
+        typename IterativeMinMaxLinearEquationSolver<ValueType>::ValueIterationResult IterativeMinMaxLinearEquationSolver<ValueType>::performPrioritizedValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType>* upperX, std::vector<ValueType> const& b, ValueType const& precision, bool relative, SolverGuarantee const& guarantee, uint64_t maximalNumberOfIterations) const {
+            if (!backwardTransitions) {
+                backwardTransitions = std::make_unique<storm::storage::SparseMatrix<ValueType>>(this->A->transpose(true));
+            }
+            uint64_t numberOfStates = this->A->getRowGroupCount();
+            std::vector<uint64_t> const& rowGroupIndices = this->A->getRowGroupIndices();
+            
+            // Computes the value of the given state after an update without changing the values.
+            auto computeUpdatedValue = [&] (uint64_t state, std::vector<ValueType> const& values) {
+                uint64_t row = rowGroupIndices[state];
+                uint64_t groupEnd = rowGroupIndices[state + 1];
+                ValueType result = this->A->multiplyRowWithVector(row, values) + b[row];
+                for (++row; row < groupEnd; ++row) {
+                    ValueType choiceValue = this->A->multiplyRowWithVector(row, values) + b[row];
+                    if (minimize(dir) ? choiceValue < result : choiceValue > result) {
+                        result = std::move(choiceValue);
+                    }
+                }
+                return result;
+            };
+            
+            // For the relative criterion, the residual bounds are scaled by the values of the states. Since a state
+            // keeps its value until it is updated (which resets its bound), the scaling does not change the order.
+            auto scaleResidual = [&] (uint64_t state, ValueType const& residual) {
+                if (relative && !storm::utility::isZero(x[state])) {
+                    return residual / storm::utility::abs<ValueType>(x[state]);
+                }
+                return residual;
+            };
+            
+            // Initially, the residuals are known exactly.
+            std::vector<ValueType> residuals(numberOfStates);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                ValueType residual = storm::utility::abs<ValueType>(computeUpdatedValue(state, x) - x[state]);
+                if (upperX) {
+                    residual = storm::utility::max<ValueType>(residual, storm::utility::abs<ValueType>(computeUpdatedValue(state, *upperX) - (*upperX)[state]));
+                }
+                residuals[state] = scaleResidual(state, residual);
+            }
+            storm::storage::ConsecutiveUint64DynamicPriorityQueue<ResidualLess<ValueType>> queue(numberOfStates, ResidualLess<ValueType>(residuals));
+            
+            // With bounds from both sides, residuals below the precision do not imply that the bounds are close enough.
+            // The required residual is then decreased until they are.
+            ValueType requiredResidual = precision;
+            
+            uint64_t iterations = 0;
+            uint64_t updates = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            while (status == SolverStatus::InProgress) {
+                if (queue.empty() || residuals[queue.top()] <= requiredResidual) {
+                    if (!upperX) {
+                        status = SolverStatus::Converged;
+                    } else if (this->hasRelevantValues() ? storm::utility::vector::equalModuloPrecision<ValueType>(x, *upperX, this->getRelevantValues(), precision, relative) : storm::utility::vector::equalModuloPrecision<ValueType>(x, *upperX, precision, relative)) {
+                        status = SolverStatus::Converged;
+                    } else if (queue.empty() || storm::utility::isZero(residuals[queue.top()])) {
+                        // Both bounds are fixed points, which is only possible if the solution is not unique.
+                        STORM_LOG_WARN("Prioritized interval iteration is stuck since the lower and upper bound are different fixed points.");
+                        status = SolverStatus::Aborted;
+                    } else {
+                        requiredResidual /= storm::utility::convertNumber<ValueType>(2.0);
+                    }
+                    continue;
+                }
+                
+                // Update the state with the largest residual.
+                uint64_t state = queue.popTop();
+                ValueType newValue = computeUpdatedValue(state, x);
+                ValueType change = storm::utility::abs<ValueType>(newValue - x[state]);
+                x[state] = std::move(newValue);
+                if (upperX) {
+                    newValue = computeUpdatedValue(state, *upperX);
+                    change = storm::utility::max<ValueType>(change, storm::utility::abs<ValueType>(newValue - (*upperX)[state]));
+                    (*upperX)[state] = std::move(newValue);
+                }
+                residuals[state] = storm::utility::zero<ValueType>();
+                
+                // Increase the residual bounds of the predecessors. The entries of a predecessor are consecutive, one
+                // for each of its choices leading to the state.
+                if (!storm::utility::isZero(change)) {
+                    auto const& predecessors = backwardTransitions->getRow(state);
+                    for (auto entryIt = predecessors.begin(); entryIt != predecessors.end();) {
+                        uint64_t predecessor = entryIt->getColumn();
+                        ValueType probability = entryIt->getValue();
+                        for (++entryIt; entryIt != predecessors.end() && entryIt->getColumn() == predecessor; ++entryIt) {
+                            probability = storm::utility::max<ValueType>(probability, entryIt->getValue());
+                        }
+                        residuals[predecessor] += scaleResidual(predecessor, probability * change);
+                        if (queue.contains(predecessor)) {
+                            queue.increase(predecessor);
+                        } else {
+                            queue.push(predecessor);
+                        }
+                    }
+                }
+                
+                // Treat as many updates as there are states as one iteration.
+                if (++updates == numberOfStates) {
+                    updates = 0;
+                    ++iterations;
+                    status = this->updateStatus(status, x, upperX ? SolverGuarantee::LessOrEqual : guarantee, iterations, maximalNumberOfIterations);
+                    if (upperX) {
+                        status = this->updateStatus(status, *upperX, SolverGuarantee::GreaterOrEqual, iterations, maximalNumberOfIterations);
+                    }
+                    this->showProgressIterative(iterations);
+                }
+            }
+            if (updates > 0) {
+                ++iterations;
+            }
+            
+            return ValueIterationResult(iterations, status);
+        }
 
+        /*!
+         * Performs Gauss-Seidel value iterations in single precision (on a compact copy of the matrix whose entries take
+         * half the memory) until the difference between two iterations is at most the given threshold. The values are
+         * then written back to x. They only serve as starting point for the iterations in the precision of the value
+         * type, in particular the threshold does not bound their error.
+         *
+         * @param maximalNumberOfIterations The budget of the single precision phase. It is independent of the budget
+         * of the subsequent iterations.
+         * @return The number of performed iterations.
+         */
+        template<typename ValueType>
+        uint64_t performSinglePrecisionValueIteration(std::unique_ptr<storm::solver::helper::oviinternal::IterationHelper<float>>&, storm::storage::SparseMatrix<ValueType> const&, OptimizationDirection, std::vector<ValueType>&, std::vector<ValueType> const&, ValueType const&, bool, uint64_t) {
+            // Single precision is only used for double values.
+            return 0;
+        }
+        
+        template<>
+        uint64_t performSinglePrecisionValueIteration(std::unique_ptr<storm::solver::helper::oviinternal::IterationHelper<float>>& helper, storm::storage::SparseMatrix<double> const& matrix, OptimizationDirection dir, std::vector<double>& x, std::vector<double> const& b, double const& threshold, bool relative, uint64_t maximalNumberOfIterations) {
+            if (!helper) {
+                if (static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) <= matrix.getEntryCount() || static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) <= matrix.getRowCount() + 1) {
+                    STORM_LOG_WARN("The matrix is too large to iterate in single precision.");
+                    return 0;
+                }
+                helper = std::make_unique<storm::solver::helper::oviinternal::IterationHelper<float>>(matrix);
+            }
+            std::vector<float> singleX = storm::utility::vector::convertNumericVector<float>(x);
+            std::vector<float> singleB = storm::utility::vector::convertNumericVector<float>(b);
+            
+            // Below a few multiples of the machine epsilon, rounding errors prevent convergence.
+            float singleThreshold = std::max(static_cast<float>(threshold), 16 * std::numeric_limits<float>::epsilon());
+            
+            // Rounding errors may still keep the difference above the threshold. We therefore stop as soon as the
+            // difference has not decreased for a number of iterations.
+            uint64_t const maximalNumberOfStagnatingIterations = 1000;
+            float smallestDiff = std::numeric_limits<float>::infinity();
+            uint64_t lastImprovement = 0;
+            
+            uint64_t iterations = 0;
+            bool converged = false;
+            while (!converged && iterations < maximalNumberOfIterations && !storm::utility::resources::isTerminate()) {
+                float diff;
+                if (matrix.hasTrivialRowGrouping()) {
+                    diff = helper->singleIterationWithDiff(singleX, singleB, relative);
+                } else {
+                    diff = helper->singleIterationWithDiff(dir, singleX, singleB, relative);
+                }
+                ++iterations;
+                
+                if (diff <= singleThreshold) {
+                    converged = true;
+                } else if (diff < smallestDiff) {
+                    smallestDiff = diff;
+                    lastImprovement = iterations;
+                } else if (iterations - lastImprovement >= maximalNumberOfStagnatingIterations) {
+                    STORM_LOG_INFO("Single precision iterations stagnate at difference " << smallestDiff << ".");
+                    break;
+                }
+            }
+            STORM_LOG_INFO("Performed " << iterations << " iterations in single precision.");
+            
+            x = storm::utility::vector::convertNumericVector<double>(singleX);
+            return iterations;
+        }
+        
         template<typename ValueType>
         ValueType computeMaxAbsDiff(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType> const& oldValues) {
             ValueType result = storm::utility::zero<ValueType>();
@@ -423,6 +771,7 @@ namespace storm {
             
             if (this->hasInitialScheduler()) {
                 // Solve the equation system induced by the initial scheduler.
+                storm::storage::SparseMatrix<ValueType> inducedMatrix;
                 std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
                 // The linear equation solver should be at least as precise as this solver
                 std::unique_ptr<storm::Environment> environmentOfSolverStorage;
@@ -445,7 +794,7 @@ namespace storm {
                 }
                 storm::Environment const& environmentOfSolver = environmentOfSolverStorage ? *environmentOfSolverStorage : env;
 
-                solveInducedEquationSystem(environmentOfSolver, linEqSolver, this->getInitialScheduler(), x, *auxiliaryRowGroupVector, b);
+                solveInducedEquationSystem(environmentOfSolver, linEqSolver, inducedMatrix, this->getInitialScheduler(), nullptr, x, *auxiliaryRowGroupVector, b);
                 // If we were given an initial scheduler and are maximizing (minimizing), our current solution becomes
                 // always less-or-equal (greater-or-equal) than the actual solution.
                 guarantee = maximize(dir) ? SolverGuarantee::LessOrEqual : SolverGuarantee::GreaterOrEqual;
@@ -470,15 +819,35 @@ namespace storm {
             std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
             std::vector<ValueType>* currentX = &x;
             
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            bool relative = env.solver().minMax().getRelativeTerminationCriterion();
             this->startMeasureProgress();
-            ValueIterationResult result = performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+            
+            // Values obtained in single precision are neither lower nor upper bounds. Hence, single precision is not
+            // used if the iterations need to approach the solution from one side.
+            uint64_t singlePrecisionIterations = 0;
+            if (env.solver().minMax().isMixedPrecisionSet()) {
+                if (guarantee == SolverGuarantee::None && !this->hasCustomTerminationCondition()) {
+                    ValueType threshold = storm::utility::max(precision, storm::utility::convertNumber<ValueType>(env.solver().minMax().getSinglePrecisionThreshold()));
+                    singlePrecisionIterations = performSinglePrecisionValueIteration(singlePrecisionIterationHelper, *this->A, dir, x, b, threshold, relative, env.solver().minMax().getMaximalNumberOfIterations());
+                } else {
+                    STORM_LOG_INFO("Not iterating in single precision as the values need to approach the solution from one side.");
+                }
+            }
+            
+            ValueIterationResult result(0, SolverStatus::InProgress);
+            if (env.solver().minMax().isPrioritizedValueIterationSet()) {
+                result = performPrioritizedValueIteration(env, dir, x, nullptr, b, precision, relative, guarantee, env.solver().minMax().getMaximalNumberOfIterations());
+            } else {
+                result = performValueIteration(env, dir, currentX, newX, b, precision, relative, guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+            }
 
             // Swap the result into the output x.
             if (currentX == auxiliaryRowGroupVector.get()) {
                 std::swap(x, *currentX);
             }
             
-            this->reportStatus(result.status, result.iterations);
+            this->reportStatus(result.status, singlePrecisionIterations + result.iterations);
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
@@ -524,6 +893,33 @@ namespace storm {
             this->createUpperBoundsVector(this->auxiliaryRowGroupVector, this->A->getRowGroupCount());
             std::vector<ValueType>* upperX = this->auxiliaryRowGroupVector.get();
             
+            if (env.solver().minMax().isPrioritizedValueIterationSet()) {
+                bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+                ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+                if (!relative) {
+                    precision *= storm::utility::convertNumber<ValueType>(2.0);
+                }
+                this->startMeasureProgress();
+                ValueIterationResult result = performPrioritizedValueIteration(env, dir, *lowerX, upperX, b, precision, relative, SolverGuarantee::LessOrEqual, env.solver().minMax().getMaximalNumberOfIterations());
+                this->reportStatus(result.status, result.iterations);
+            
+                // We take the means of the lower and upper bound so we guarantee the desired precision.
+                ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+                storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(*lowerX, *upperX, *lowerX, [&two] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+            
+                // If requested, we store the scheduler for retrieval.
+                if (this->isTrackSchedulerSet()) {
+                    this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                    this->multiplierA->multiplyAndReduce(env, dir, x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
+                }
+            
+                if (!this->isCachingEnabled()) {
+                    clearCache();
+                }
+            
+                return result.status == SolverStatus::Converged;
+            }
+            
             std::vector<ValueType>* tmp = nullptr;
             if (!useGaussSeidelMultiplication) {
                 auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(lowerX->size());
@@ -986,6 +1382,14 @@ namespace storm {
             uint64_t valueIterationInvocations = 0;
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
             impreciseSolver.startMeasureProgress();
+            
+            // With mixed precision, the first value iteration starts in single precision. Since the solution is
+            // sharpened and checked in the rational type, this does not affect the correctness of the result. The
+            // single precision iterations have their own budget and do not count towards the overall iterations.
+            if (env.solver().minMax().isMixedPrecisionSet()) {
+                ImpreciseType threshold = storm::utility::convertNumber<ImpreciseType>(env.solver().minMax().getSinglePrecisionThreshold());
+                performSinglePrecisionValueIteration(impreciseSolver.singlePrecisionIterationHelper, A, dir, *currentX, b, threshold, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations());
+            }
             while (status == SolverStatus::InProgress && overallIterations < env.solver().minMax().getMaximalNumberOfIterations()) {
                 // Perform value iteration with the current precision.
                 typename IterativeMinMaxLinearEquationSolver<ImpreciseType>::ValueIterationResult result = impreciseSolver.performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ImpreciseType, ValueType>(precision), env.solver().minMax().getRelativeTerminationCriterion(), SolverGuarantee::LessOrEqual, overallIterations, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
@@ -1071,6 +1475,8 @@ namespace storm {
             multiplierA.reset();
             auxiliaryRowGroupVector.reset();
             auxiliaryRowGroupVector2.reset();
+            backwardTransitions.reset();
+            singlePrecisionIterationHelper.reset();
             soundValueIterationHelper.reset();
             optimisticValueIterationHelper.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
@@ -35,10 +35,17 @@ namespace storm {
             
             MinMaxMethod getMethod(Environment const& env, bool isExactMode) const;
             
-            bool solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const;
+            /*!
+             * Solves the equation system induced by the given scheduler. The induced matrix is stored in the given
+             * matrix, which the given linear equation solver refers to. If the induced system was solved before for a
+             * scheduler that only differs in the given (ascending) row groups, only these rows are replaced.
+             */
+            bool solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, storm::storage::SparseMatrix<ValueType>& inducedMatrix, std::vector<uint64_t> const& scheduler, std::vector<uint64_t> const* changedRowGroups, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const;
             bool solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool performPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
             bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
+            bool solveEquationsModifiedPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            uint64_t approximatePolicyValues(std::vector<uint_fast64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t maximalNumberOfSweeps, ValueType const& precision, bool relative) const;
 
             bool solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool solveEquationsOptimisticValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
@@ -76,6 +83,20 @@ namespace storm {
             
             ValueIterationResult performValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision, bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t  maximalNumberOfIterations, storm::solver::MultiplicationStyle const& multiplicationStyle) const;
             
+            /*!
+             * Performs value iteration in which the states are updated one by one in the order of an upper bound on
+             * their residual, i.e., the change of their value in the next update. The bound of a state grows whenever
+             * one of its successors is updated.
+             *
+             * @param x The values that are updated in place.
+             * @param upperX If given, these values are updated alongside x. Both are then treated as lower and upper
+             * bounds (as in interval iteration) and the method only converges once the bounds are close enough.
+             * @param precision The precision that the residuals (or the difference of the bounds) need to achieve.
+             * @return The number of performed iterations (where one iteration corresponds to as many updates as there
+             * are states) and the status of the method.
+             */
+            ValueIterationResult performPrioritizedValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType>* upperX, std::vector<ValueType> const& b, ValueType const& precision, bool relative, SolverGuarantee const& guarantee, uint64_t maximalNumberOfIterations) const;
+            
             void createLinearEquationSolver(Environment const& env) const;
             
             /// The factory used to obtain linear equation solvers.
@@ -85,8 +106,10 @@ namespace storm {
             mutable std::unique_ptr<storm::solver::Multiplier<ValueType>> multiplierA;
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector2; // A.rowGroupCount() entries
+            mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> backwardTransitions; // only used by prioritized value iteration
             mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
             mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
+            mutable std::unique_ptr<storm::solver::helper::oviinternal::IterationHelper<float>> singlePrecisionIterationHelper; // only used with mixed precision
             
         };
         
@@ -26,6 +26,8 @@ namespace storm {
                     return "vi-to-pi";
                 case MinMaxMethod::Acyclic:
                     return "vi-to-pi";
+                case MinMaxMethod::ModifiedPolicyIteration:
+                    return "modifiedpolicy";
             }
             return "invalid";
         }
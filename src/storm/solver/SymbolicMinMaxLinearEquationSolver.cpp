@@ -99,6 +99,7 @@ namespace storm {
                 // Set up next iteration.
                 localX = tmp;
                 ++iterations;
+                localX.getDdManager().checkMemoryBudget();
                 if (storm::utility::resources::isTerminate()) {
                     status = SolverStatus::Aborted;
                 }
@@ -137,6 +137,7 @@ namespace storm {
                 // Set up next iteration.
                 ++iterations;
                 currentX = tmp;
+                currentX.getDdManager().checkMemoryBudget();
             }
 
             return PowerIterationResult(status, iterations, currentX);
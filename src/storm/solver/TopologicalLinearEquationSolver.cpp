@@ -1,31 +1,36 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <atomic>
+#include <type_traits>
+
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/SignalHandler.h"
 
 namespace storm {
     namespace solver {
 
         template<typename ValueType>
-        TopologicalLinearEquationSolver<ValueType>::TopologicalLinearEquationSolver() : localA(nullptr), A(nullptr) {
+        TopologicalLinearEquationSolver<ValueType>::TopologicalLinearEquationSolver() : localA(nullptr), A(nullptr), sccMatricesAreEquationSystems(false) {
             // Intentionally left empty.
         }
 
         template<typename ValueType>
-        TopologicalLinearEquationSolver<ValueType>::TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) : localA(nullptr), A(nullptr) {
+        TopologicalLinearEquationSolver<ValueType>::TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) : localA(nullptr), A(nullptr), sccMatricesAreEquationSystems(false) {
             this->setMatrix(A);
         }
 
         template<typename ValueType>
-        TopologicalLinearEquationSolver<ValueType>::TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) : localA(nullptr), A(nullptr) {
+        TopologicalLinearEquationSolver<ValueType>::TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) : localA(nullptr), A(nullptr), sccMatricesAreEquationSystems(false) {
             this->setMatrix(std::move(A));
         }
         
@@ -83,27 +88,33 @@ namespace storm {
             if (this->sortedSccDecomposition->size() == 1) {
                 returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
             } else {
-                // Solve each SCC individually
-                storm::storage::BitVector sccAsBitVector(x.size(), false);
-                uint64_t sccIndex = 0;
-                storm::utility::ProgressMeasurement progress("states");
-                progress.setMaxCount(x.size());
-                progress.startNewMeasurement(0);
-                for (auto const& scc : *this->sortedSccDecomposition) {
-                    if (scc.size() == 1) {
-                        returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
-                    } else {
-                        sccAsBitVector.clear();
-                        for (auto const& state : scc) {
-                            sccAsBitVector.set(state, true);
+                uint64_t numberOfThreads = env.solver().topological().getNumberOfThreads();
+                if (numberOfThreads > 1 && !storm::NumberTraits<ValueType>::SupportsConcurrency) {
+                    STORM_LOG_WARN("SCCs are only solved concurrently for floating-point computations. Falling back to a single thread.");
+                    numberOfThreads = 1;
+                }
+                prepareSccWorkspaces(sccSolverEnvironment, numberOfThreads);
+                
+                if (numberOfThreads > 1) {
+                    returnValue = solveSccsConcurrently(sccSolverEnvironment, numberOfThreads, x, b);
+                } else {
+                    // Solve each SCC individually
+                    uint64_t sccIndex = 0;
+                    storm::utility::ProgressMeasurement progress("states");
+                    progress.setMaxCount(x.size());
+                    progress.startNewMeasurement(0);
+                    for (auto const& scc : *this->sortedSccDecomposition) {
+                        if (scc.size() == 1) {
+                            returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+                        } else {
+                            returnValue = solveScc(this->sccWorkspaces.front(), sccSolverEnvironment, sccIndex, x, b) && returnValue;
+                        }
+                        ++sccIndex;
+                        progress.updateProgress(sccIndex);
+                        if (storm::utility::resources::isTerminate()) {
+                            STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                            break;
                         }
-                        returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
-                    }
-                    ++sccIndex;
-                    progress.updateProgress(sccIndex);
-                    if (storm::utility::resources::isTerminate()) {
-                        STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                        break;
                     }
                 }
             }
@@ -111,9 +122,6 @@ namespace storm {
             if (!this->isCachingEnabled()) {
                 clearCache();
             }
-
-            
-
             
             return returnValue;
         }
@@ -125,6 +133,20 @@ namespace storm {
             if (needLongestChainSize) {
                 this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
             }
+            
+            // Remember the position of each state in the decomposition to extract the matrices of the SCCs.
+            this->sccOfState.resize(this->getMatrixRowCount());
+            this->indexInScc.resize(this->getMatrixRowCount());
+            for (uint64_t sccIndex = 0; sccIndex < this->sortedSccDecomposition->size(); ++sccIndex) {
+                uint64_t index = 0;
+                for (auto const& state : this->sortedSccDecomposition->getBlock(sccIndex)) {
+                    this->sccOfState[state] = sccIndex;
+                    this->indexInScc[state] = index;
+                    ++index;
+                }
+            }
+            this->sccMatrices.clear();
+            this->sccTaskGraph.reset();
         }
         
         template<typename ValueType>
@@ -173,32 +195,69 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
-            
-            // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+        void TopologicalLinearEquationSolver<ValueType>::prepareSccWorkspaces(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads) const {
+            if (this->sccWorkspaces.size() < numberOfThreads) {
+                this->sccWorkspaces.resize(numberOfThreads);
+            }
+            for (auto& workspace : this->sccWorkspaces) {
+                if (!workspace.solver) {
+                    workspace.solver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                    workspace.solver->setCachingEnabled(true);
+                }
             }
             
-            // Matrix
-            bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
-            storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
+            // The matrices of the SCCs are kept for subsequent calls as long as they have the format required by the solvers.
+            if (this->isCachingEnabled()) {
+                bool asEquationSystem = this->sccWorkspaces.front().solver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+                if (this->sccMatrices.empty() || this->sccMatricesAreEquationSystems != asEquationSystem) {
+                    this->sccMatrices.clear();
+                    this->sccMatrices.resize(this->sortedSccDecomposition->size());
+                    this->sccMatricesAreEquationSystems = asEquationSystem;
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::setToSccMatrix(storm::storage::SparseMatrix<ValueType>& sccMatrix, std::vector<uint64_t> const& sccStates, uint64_t const& sccIndex, bool asEquationSystem) const {
+            // As the states of the SCC are sorted, the columns of each row remain sorted.
+            sccMatrix.setToBlockSubmatrix(*this->A, sccStates, this->sccOfState, sccIndex, this->indexInScc, asEquationSystem);
             if (asEquationSystem) {
-                sccA.convertToEquationSystem();
+                sccMatrix.convertToEquationSystem();
             }
-            this->sccSolver->setMatrix(std::move(sccA));
+        }
+        
+        template<typename ValueType>
+        bool TopologicalLinearEquationSolver<ValueType>::solveScc(SccWorkspace& workspace, storm::Environment const& sccSolverEnvironment, uint64_t const& sccIndex, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+            auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+            storm::solver::LinearEquationSolver<ValueType>& sccSolver = *workspace.solver;
+            workspace.states.assign(scc.begin(), scc.end());
             
-            // x Vector
-            auto sccX = storm::utility::vector::filterVector(globalX, scc);
+            // Matrix
+            bool asEquationSystem = sccSolver.getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+            if (this->isCachingEnabled()) {
+                STORM_LOG_ASSERT(this->sccMatricesAreEquationSystems == asEquationSystem, "The cached SCC matrices have the wrong format.");
+                std::unique_ptr<storm::storage::SparseMatrix<ValueType>>& sccA = this->sccMatrices[sccIndex];
+                if (!sccA) {
+                    sccA = std::make_unique<storm::storage::SparseMatrix<ValueType>>();
+                    setToSccMatrix(*sccA, workspace.states, sccIndex, asEquationSystem);
+                }
+                sccSolver.setMatrix(*sccA);
+            } else {
+                // The matrix of the workspace is overwritten in place, which avoids allocations once it is large enough.
+                setToSccMatrix(workspace.matrix, workspace.states, sccIndex, asEquationSystem);
+                sccSolver.setMatrix(workspace.matrix);
+            }
             
-            // b Vector
-            std::vector<ValueType> sccB;
-            sccB.reserve(scc.getNumberOfSetBits());
-            for (auto const& row : scc) {
+            // x and b Vector
+            std::vector<ValueType>& sccX = workspace.x;
+            std::vector<ValueType>& sccB = workspace.b;
+            sccX.clear();
+            sccB.clear();
+            for (auto const& row : workspace.states) {
+                sccX.push_back(globalX[row]);
                 ValueType bi = globalB[row];
                 for (auto const& entry : this->A->getRow(row)) {
-                    if (!scc.get(entry.getColumn())) {
+                    if (this->sccOfState[entry.getColumn()] != sccIndex) {
                         bi += entry.getValue() * globalX[entry.getColumn()];
                     }
                 }
@@ -207,24 +266,62 @@ namespace storm {
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver.setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+                std::vector<ValueType> sccLowerBounds;
+                sccLowerBounds.reserve(scc.size());
+                for (auto const& state : workspace.states) {
+                    sccLowerBounds.push_back(this->getLowerBounds()[state]);
+                }
+                sccSolver.setLowerBounds(std::move(sccLowerBounds));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver.setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+                std::vector<ValueType> sccUpperBounds;
+                sccUpperBounds.reserve(scc.size());
+                for (auto const& state : workspace.states) {
+                    sccUpperBounds.push_back(this->getUpperBounds()[state]);
+                }
+                sccSolver.setUpperBounds(std::move(sccUpperBounds));
             }
             
-            //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
-            //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
-            
-            bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
-            storm::utility::vector::setVectorValues(globalX, scc, sccX);
+            bool returnvalue = sccSolver.solveEquations(sccSolverEnvironment, sccX, sccB);
+            auto sccXIt = sccX.begin();
+            for (auto const& state : workspace.states) {
+                globalX[state] = std::move(*sccXIt);
+                ++sccXIt;
+            }
             return returnvalue;
         }
         
+        template<typename ValueType>
+        bool TopologicalLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+            if (!this->sccTaskGraph) {
+                this->sccTaskGraph = storm::solver::helper::createSccTaskGraph(*this->A, *this->sortedSccDecomposition);
+                STORM_LOG_THROW(this->sccTaskGraph, storm::exceptions::NotSupportedException, "SCCs are only solved concurrently for floating-point computations.");
+            }
+            STORM_LOG_INFO("Solving " << this->sccTaskGraph->getNumberOfSccs() << " SCCs with " << numberOfThreads << " threads.");
+            
+            // Trivial SCCs are solved with a few operations, so a thread takes several of them at once to reduce the synchronization overhead.
+            uint64_t const minimalBatchSize = 256;
+            std::atomic<bool> allSccsSolved(true);
+            bool completed = this->sccTaskGraph->execute(numberOfThreads, minimalBatchSize, [&] (uint64_t thread, uint64_t sccIndex) {
+                auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+                bool sccSolved;
+                if (scc.size() == 1) {
+                    sccSolved = solveTrivialScc(*scc.begin(), globalX, globalB);
+                } else {
+                    sccSolved = solveScc(this->sccWorkspaces[thread], sccSolverEnvironment, sccIndex, globalX, globalB);
+                }
+                if (!sccSolved) {
+                    allSccsSolved = false;
+                }
+            });
+            STORM_LOG_WARN_COND(completed, "Topological solver aborted before analyzing all SCCs.");
+            return allSccsSolved;
+        }
+        
         template<typename ValueType>
         LinearEquationSolverProblemFormat TopologicalLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
             return LinearEquationSolverProblemFormat::FixedPointSystem;
@@ -241,6 +338,11 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            sccWorkspaces.clear();
+            sccOfState.clear();
+            indexInScc.clear();
+            sccMatrices.clear();
+            sccTaskGraph.reset();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
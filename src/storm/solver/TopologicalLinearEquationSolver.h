@@ -5,6 +5,7 @@
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/solver/helper/SccTaskGraph.h"
 
 namespace storm {
     
@@ -37,6 +38,15 @@ namespace storm {
 
             storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
             
+            // The data that is needed to solve a non-trivial SCC. Its memory is reused for all SCCs that are solved by the same thread.
+            struct SccWorkspace {
+                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver;
+                std::vector<uint64_t> states;
+                storm::storage::SparseMatrix<ValueType> matrix; // only used if the SCC matrices are not cached
+                std::vector<ValueType> x;
+                std::vector<ValueType> b;
+            };
+            
             // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
             void createSortedSccDecomposition(bool needLongestChainSize) const;
             
@@ -46,7 +56,16 @@ namespace storm {
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            bool solveScc(SccWorkspace& workspace, storm::Environment const& sccSolverEnvironment, uint64_t const& sccIndex, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            
+            // Solves the SCCs concurrently with the given number of threads, where each SCC is solved once all SCCs it reaches are solved.
+            bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            
+            // Creates the workspaces for the non-trivial SCCs (one per thread) and prepares the cache of SCC matrices.
+            void prepareSccWorkspaces(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads) const;
+            
+            // Overwrites the given matrix with the matrix of the SCC with the given index. Diagonal entries are inserted if the matrix is to be converted to an equation system.
+            void setToSccMatrix(storm::storage::SparseMatrix<ValueType>& sccMatrix, std::vector<uint64_t> const& sccStates, uint64_t const& sccIndex, bool asEquationSystem) const;
 
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
             // when the solver is destructed.
@@ -60,6 +79,12 @@ namespace storm {
             mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+            mutable std::vector<SccWorkspace> sccWorkspaces; // one workspace for the non-trivial SCCs per thread
+            mutable std::vector<uint64_t> sccOfState; // the index of the SCC of each state
+            mutable std::vector<uint64_t> indexInScc; // the index of each state within its SCC
+            mutable std::vector<std::unique_ptr<storm::storage::SparseMatrix<ValueType>>> sccMatrices; // the matrices of the non-trivial SCCs (only if caching is enabled)
+            mutable bool sccMatricesAreEquationSystems;
+            mutable std::unique_ptr<storm::solver::helper::SccTaskGraph> sccTaskGraph;
         };
         
         template<typename ValueType>
@@ -1,5 +1,8 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <atomic>
+#include <type_traits>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
@@ -7,9 +10,11 @@
 #include "storm/utility/vector.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/utility/SignalHandler.h"
 
@@ -81,32 +86,35 @@ namespace storm {
                         this->schedulerChoices = std::vector<uint64_t>(x.size());
                     }
                 }
-                storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-                storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-                uint64_t sccIndex = 0;
-                storm::utility::ProgressMeasurement progress("states");
-                progress.setMaxCount(x.size());
-                progress.startNewMeasurement(0);
-                for (auto const& scc : *this->sortedSccDecomposition) {
-                    if (scc.size() == 1) {
-                        returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-                    } else {
-                        STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                        sccRowGroupsAsBitVector.clear();
-                        sccRowsAsBitVector.clear();
-                        for (auto const& group : scc) {
-                            sccRowGroupsAsBitVector.set(group, true);
-                            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                                sccRowsAsBitVector.set(row, true);
-                            }
+                
+                uint64_t numberOfThreads = env.solver().topological().getNumberOfThreads();
+                if (numberOfThreads > 1 && !storm::NumberTraits<ValueType>::SupportsConcurrency) {
+                    STORM_LOG_WARN("SCCs are only solved concurrently for floating-point computations. Falling back to a single thread.");
+                    numberOfThreads = 1;
+                }
+                
+                prepareSccWorkspaces(sccSolverEnvironment, numberOfThreads);
+                
+                if (numberOfThreads > 1) {
+                    returnValue = solveSccsConcurrently(sccSolverEnvironment, numberOfThreads, dir, x, b);
+                } else {
+                    uint64_t sccIndex = 0;
+                    storm::utility::ProgressMeasurement progress("states");
+                    progress.setMaxCount(x.size());
+                    progress.startNewMeasurement(0);
+                    for (auto const& scc : *this->sortedSccDecomposition) {
+                        if (scc.size() == 1) {
+                            returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                        } else {
+                            STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                            returnValue = solveScc(this->sccWorkspaces.front(), sccSolverEnvironment, dir, sccIndex, x, b) && returnValue;
+                        }
+                        ++sccIndex;
+                        progress.updateProgress(sccIndex);
+                        if (storm::utility::resources::isTerminate()) {
+                            STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                            break;
                         }
-                        returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-                    }
-                    ++sccIndex;
-                    progress.updateProgress(sccIndex);
-                    if (storm::utility::resources::isTerminate()) {
-                        STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                        break;
                     }
                 }
                 
@@ -131,9 +139,22 @@ namespace storm {
         void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
             // Obtain the scc decomposition
             this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+            this->sccTaskGraph.reset();
             if (needLongestChainSize) {
                 this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
             }
+            
+            // Remember the position of each state in the decomposition to extract the matrices of the SCCs.
+            this->sccOfState.resize(this->A->getRowGroupCount());
+            this->indexInScc.resize(this->A->getRowGroupCount());
+            for (uint64_t sccIndex = 0; sccIndex < this->sortedSccDecomposition->size(); ++sccIndex) {
+                uint64_t index = 0;
+                for (auto const& state : this->sortedSccDecomposition->getBlock(sccIndex)) {
+                    this->sccOfState[state] = sccIndex;
+                    this->indexInScc[state] = index;
+                    ++index;
+                }
+            }
         }
         
         template<typename ValueType>
@@ -230,58 +251,72 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(SccWorkspace& workspace, storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, uint64_t const& sccIndex, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+            auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+            storm::solver::MinMaxLinearEquationSolver<ValueType>& sccSolver = *workspace.solver;
+            workspace.states.assign(scc.begin(), scc.end());
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
-            }
-            this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-            this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-            this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
-            
-            // SCC Matrix
-            storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, sccRowGroups, sccRowGroups);
-            //std::cout << "Matrix is " << sccA << std::endl;
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver.setHasUniqueSolution(this->hasUniqueSolution());
+            sccSolver.setHasNoEndComponents(this->hasNoEndComponents());
+            sccSolver.setTrackScheduler(this->isTrackSchedulerSet());
             
-            // x Vector
-            auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
+            // SCC Matrix. The matrix of the workspace is overwritten in place, which avoids allocations once it is large enough.
+            workspace.matrix.setToBlockSubmatrix(*this->A, workspace.states, this->sccOfState, sccIndex, this->indexInScc);
+            sccSolver.setMatrix(workspace.matrix);
             
-            // b Vector
-            std::vector<ValueType> sccB;
-            sccB.reserve(sccRows.getNumberOfSetBits());
-            for (auto const& row : sccRows) {
-                ValueType bi = globalB[row];
-                for (auto const& entry : this->A->getRow(row)) {
-                    if (!sccRowGroups.get(entry.getColumn())) {
-                        bi += entry.getValue() * globalX[entry.getColumn()];
+            // x and b Vector
+            std::vector<ValueType>& sccX = workspace.x;
+            std::vector<ValueType>& sccB = workspace.b;
+            sccX.clear();
+            sccB.clear();
+            for (auto const& group : workspace.states) {
+                sccX.push_back(globalX[group]);
+                for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                    ValueType bi = globalB[row];
+                    for (auto const& entry : this->A->getRow(row)) {
+                        if (this->sccOfState[entry.getColumn()] != sccIndex) {
+                            bi += entry.getValue() * globalX[entry.getColumn()];
+                        }
                     }
+                    sccB.push_back(std::move(bi));
                 }
-                sccB.push_back(std::move(bi));
             }
             
             // initial scheduler
             if (this->hasInitialScheduler()) {
-                auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-                this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+                std::vector<uint64_t> sccInitChoices;
+                sccInitChoices.reserve(scc.size());
+                for (auto const& group : workspace.states) {
+                    sccInitChoices.push_back(this->getInitialScheduler()[group]);
+                }
+                sccSolver.setInitialScheduler(std::move(sccInitChoices));
             }
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver.setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+                std::vector<ValueType> sccLowerBounds;
+                sccLowerBounds.reserve(scc.size());
+                for (auto const& group : workspace.states) {
+                    sccLowerBounds.push_back(this->getLowerBounds()[group]);
+                }
+                sccSolver.setLowerBounds(std::move(sccLowerBounds));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver.setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+                std::vector<ValueType> sccUpperBounds;
+                sccUpperBounds.reserve(scc.size());
+                for (auto const& group : workspace.states) {
+                    sccUpperBounds.push_back(this->getUpperBounds()[group]);
+                }
+                sccSolver.setUpperBounds(std::move(sccUpperBounds));
             }
             
             // Requirements
-            auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+            auto req = sccSolver.getRequirements(sccSolverEnvironment, dir);
             if (req.upperBounds() && this->hasUpperBound()) {
                 req.clearUpperBounds();
             }
@@ -295,24 +330,70 @@ namespace storm {
                 req.clearUniqueSolution();
             }
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-            this->sccSolver->setRequirementsChecked(true);
+            sccSolver.setRequirementsChecked(true);
 
             // Invoke scc solver
-            bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
-            //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
-            //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
+            bool res = sccSolver.solveEquations(sccSolverEnvironment, dir, sccX, sccB);
             
             // Set Scheduler choices
             if (this->isTrackSchedulerSet()) {
-                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+                auto sccChoiceIt = sccSolver.getSchedulerChoices().begin();
+                for (auto const& group : workspace.states) {
+                    this->schedulerChoices.get()[group] = *sccChoiceIt;
+                    ++sccChoiceIt;
+                }
             }
             
             // Set solution
-            storm::utility::vector::setVectorValues(globalX, sccRowGroups, sccX);
+            auto sccXIt = sccX.begin();
+            for (auto const& group : workspace.states) {
+                globalX[group] = std::move(*sccXIt);
+                ++sccXIt;
+            }
             
             return res;
         }
         
+        template<typename ValueType>
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, OptimizationDirection dir, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+            if (!this->sccTaskGraph) {
+                this->sccTaskGraph = storm::solver::helper::createSccTaskGraph(*this->A, *this->sortedSccDecomposition);
+                STORM_LOG_THROW(this->sccTaskGraph, storm::exceptions::NotSupportedException, "SCCs are only solved concurrently for floating-point computations.");
+            }
+            STORM_LOG_INFO("Solving " << this->sccTaskGraph->getNumberOfSccs() << " SCCs with " << numberOfThreads << " threads.");
+            
+            // Trivial SCCs are solved with a few operations, so a thread takes several of them at once to reduce the synchronization overhead.
+            uint64_t const minimalBatchSize = 256;
+            std::atomic<bool> allSccsSolved(true);
+            bool completed = this->sccTaskGraph->execute(numberOfThreads, minimalBatchSize, [&] (uint64_t thread, uint64_t sccIndex) {
+                auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+                bool sccSolved;
+                if (scc.size() == 1) {
+                    sccSolved = solveTrivialScc(*scc.begin(), dir, globalX, globalB);
+                } else {
+                    sccSolved = solveScc(this->sccWorkspaces[thread], sccSolverEnvironment, dir, sccIndex, globalX, globalB);
+                }
+                if (!sccSolved) {
+                    allSccsSolved = false;
+                }
+            });
+            STORM_LOG_WARN_COND(completed, "Topological solver aborted before analyzing all SCCs.");
+            return allSccsSolved;
+        }
+        
+        template<typename ValueType>
+        void TopologicalMinMaxLinearEquationSolver<ValueType>::prepareSccWorkspaces(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads) const {
+            if (this->sccWorkspaces.size() < numberOfThreads) {
+                this->sccWorkspaces.resize(numberOfThreads);
+            }
+            for (auto& workspace : this->sccWorkspaces) {
+                if (!workspace.solver) {
+                    workspace.solver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                    workspace.solver->setCachingEnabled(true);
+                }
+            }
+        }
+        
         template<typename ValueType>
         MinMaxLinearEquationSolverRequirements TopologicalMinMaxLinearEquationSolver<ValueType>::getRequirements(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const& hasInitialScheduler) const {
             // Return the requirements of the underlying solver
@@ -324,6 +405,10 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            sccWorkspaces.clear();
+            sccOfState.clear();
+            indexInScc.clear();
+            sccTaskGraph.reset();
             auxiliaryRowGroupVector.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
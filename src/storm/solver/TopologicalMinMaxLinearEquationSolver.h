@@ -4,6 +4,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/solver/helper/SccTaskGraph.h"
 
 namespace storm {
 
@@ -32,6 +33,15 @@ namespace storm {
         private:
             storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
+            // The data that is needed to solve a non-trivial SCC. Its memory is reused for all SCCs that are solved by the same thread.
+            struct SccWorkspace {
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+                std::vector<uint64_t> states;
+                storm::storage::SparseMatrix<ValueType> matrix;
+                std::vector<ValueType> x;
+                std::vector<ValueType> b;
+            };
+
             // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
             void createSortedSccDecomposition(bool needLongestChainSize) const;
 
@@ -41,12 +51,22 @@ namespace storm {
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            bool solveScc(SccWorkspace& workspace, storm::Environment const& sccSolverEnvironment, OptimizationDirection d, uint64_t const& sccIndex, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            
+            // Solves the SCCs concurrently with the given number of threads, where each SCC is solved once all SCCs it reaches are solved.
+            bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, OptimizationDirection d, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            
+            // Creates the workspaces for the non-trivial SCCs (one per thread).
+            void prepareSccWorkspaces(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads) const;
 
             // cached auxiliary data
             mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
+            mutable std::vector<SccWorkspace> sccWorkspaces; // one workspace for the non-trivial SCCs per thread
+            mutable std::vector<uint64_t> sccOfState; // the index of the SCC of each state
+            mutable std::vector<uint64_t> indexInScc; // the index of each state within its SCC
+            mutable std::unique_ptr<storm::solver::helper::SccTaskGraph> sccTaskGraph;
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
         };
     }
@@ -31,7 +31,8 @@ namespace storm {
                 }
                 
                 template <typename ValueType>
-                IterationHelper<ValueType>::IterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix) {
+                template <typename MatrixValueType>
+                IterationHelper<ValueType>::IterationHelper(storm::storage::SparseMatrix<MatrixValueType> const& matrix) {
                     STORM_LOG_THROW(static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) > matrix.getRowCount() + 1, storm::exceptions::NotSupportedException, "Matrix dimensions too large.");
                     STORM_LOG_THROW(static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) > matrix.getEntryCount(), storm::exceptions::NotSupportedException, "Matrix dimensions too large.");
                     matrixValues.reserve(matrix.getNonzeroEntryCount());
@@ -40,7 +41,7 @@ namespace storm {
                     rowIndications.push_back(0);
                     for (IndexType r = 0; r < static_cast<IndexType>(matrix.getRowCount()); ++r) {
                         for (auto const& entry : matrix.getRow(r)) {
-                            matrixValues.push_back(entry.getValue());
+                            matrixValues.push_back(storm::utility::convertNumber<ValueType>(entry.getValue()));
                             matrixColumns.push_back(entry.getColumn());
                         }
                         rowIndications.push_back(matrixValues.size());
@@ -368,6 +369,10 @@ namespace storm {
             
             template class OptimisticValueIterationHelper<double>;
             template class OptimisticValueIterationHelper<storm::RationalNumber>;
+            
+            // Used for the single precision iterations of value iteration with mixed precision.
+            template class oviinternal::IterationHelper<float>;
+            template oviinternal::IterationHelper<float>::IterationHelper(storm::storage::SparseMatrix<double> const& matrix);
         }
     }
 }
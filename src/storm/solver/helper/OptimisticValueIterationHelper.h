@@ -21,7 +21,10 @@ namespace storm {
                 class IterationHelper {
                 public:
                     typedef uint32_t IndexType;
-                    IterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+                    
+                    /// creates a copy of the given matrix whose entries are converted to the value type of this helper
+                    template<typename MatrixValueType>
+                    IterationHelper(storm::storage::SparseMatrix<MatrixValueType> const& matrix);
                     enum class IterateResult {
                         AlwaysHigherOrEqual,
                         AlwaysLowerOrEqual,
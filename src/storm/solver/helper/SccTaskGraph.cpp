@@ -0,0 +1,173 @@
+#include "storm/solver/helper/SccTaskGraph.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <mutex>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<typename ValueType>
+            SccTaskGraph::SccTaskGraph(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition) : sccSizes(sccDecomposition.size()), numberOfDependencies(sccDecomposition.size(), 0), dependentIndices(sccDecomposition.size() + 1, 0) {
+                std::vector<uint64_t> stateToScc(matrix.getRowGroupCount());
+                for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+                    sccSizes[sccIndex] = sccDecomposition.getBlock(sccIndex).size();
+                    for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+                        stateToScc[state] = sccIndex;
+                    }
+                }
+
+                // Collect the dependencies of every SCC. The last SCC that depended on an SCC is remembered to avoid
+                // duplicate dependencies.
+                std::vector<std::pair<uint64_t, uint64_t>> dependencies;
+                std::vector<uint64_t> lastDependentScc(sccDecomposition.size(), sccDecomposition.size());
+                for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+                    for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+                        for (auto const& entry : matrix.getRowGroup(state)) {
+                            uint64_t successorScc = stateToScc[entry.getColumn()];
+                            if (successorScc != sccIndex && lastDependentScc[successorScc] != sccIndex) {
+                                lastDependentScc[successorScc] = sccIndex;
+                                dependencies.emplace_back(successorScc, sccIndex);
+                                ++numberOfDependencies[sccIndex];
+                                ++dependentIndices[successorScc + 1];
+                            }
+                        }
+                    }
+                }
+
+                for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+                    dependentIndices[sccIndex + 1] += dependentIndices[sccIndex];
+                }
+                dependents.resize(dependencies.size());
+                std::vector<uint64_t> nextDependentPosition(dependentIndices.begin(), dependentIndices.end() - 1);
+                for (auto const& dependency : dependencies) {
+                    dependents[nextDependentPosition[dependency.first]++] = dependency.second;
+                }
+            }
+
+            bool SccTaskGraph::execute(uint64_t numberOfThreads, uint64_t minimalBatchSize, std::function<void(uint64_t, uint64_t)> const& solveScc) const {
+                numberOfThreads = std::max<uint64_t>(numberOfThreads, 1);
+                uint64_t numberOfSccs = getNumberOfSccs();
+
+                // The shared state of the threads, which is only accessed while holding the mutex.
+                std::mutex mutex;
+                std::condition_variable readySccsChanged;
+                std::vector<uint64_t> remainingDependencies = numberOfDependencies;
+                std::vector<uint64_t> readySccs;
+                uint64_t numberOfSolvedSccs = 0;
+                bool aborted = false;
+
+                // SCCs are taken from the back, so SCCs with smaller indices are solved first.
+                for (uint64_t sccIndex = numberOfSccs; sccIndex > 0; --sccIndex) {
+                    if (remainingDependencies[sccIndex - 1] == 0) {
+                        readySccs.push_back(sccIndex - 1);
+                    }
+                }
+
+                auto worker = [&] (uint64_t thread) {
+                    std::vector<uint64_t> batch;
+                    while (true) {
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+
+                            // Release the SCCs that depend on the SCCs of the previous batch.
+                            for (auto const& sccIndex : batch) {
+                                for (uint64_t dependentIndex = dependentIndices[sccIndex]; dependentIndex < dependentIndices[sccIndex + 1]; ++dependentIndex) {
+                                    uint64_t dependentScc = dependents[dependentIndex];
+                                    if (--remainingDependencies[dependentScc] == 0) {
+                                        readySccs.push_back(dependentScc);
+                                    }
+                                }
+                            }
+                            numberOfSolvedSccs += batch.size();
+                            batch.clear();
+                            readySccsChanged.notify_all();
+
+                            readySccsChanged.wait(lock, [&] { return aborted || !readySccs.empty() || numberOfSolvedSccs == numberOfSccs; });
+                            if (aborted || readySccs.empty()) {
+                                return;
+                            }
+
+                            // Leave some of the ready SCCs to the other threads.
+                            uint64_t maximalBatchLength = (readySccs.size() + numberOfThreads - 1) / numberOfThreads;
+                            uint64_t batchSize = 0;
+                            while (!readySccs.empty() && batch.size() < maximalBatchLength && batchSize < minimalBatchSize) {
+                                batch.push_back(readySccs.back());
+                                batchSize += sccSizes[readySccs.back()];
+                                readySccs.pop_back();
+                            }
+                        }
+
+                        try {
+                            for (auto const& sccIndex : batch) {
+                                solveScc(thread, sccIndex);
+                            }
+                        } catch (...) {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            aborted = true;
+                            readySccsChanged.notify_all();
+                            throw;
+                        }
+
+                        if (storm::utility::resources::isTerminate()) {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            aborted = true;
+                            readySccsChanged.notify_all();
+                            return;
+                        }
+                    }
+                };
+
+                std::vector<std::future<void>> workers;
+                for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                    workers.push_back(std::async(std::launch::async, worker, thread));
+                }
+                std::exception_ptr exception;
+                try {
+                    worker(0);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+
+                // Wait for all threads before rethrowing any exception, as they access the local state.
+                for (auto& future : workers) {
+                    future.wait();
+                }
+                for (auto& future : workers) {
+                    try {
+                        future.get();
+                    } catch (...) {
+                        if (!exception) {
+                            exception = std::current_exception();
+                        }
+                    }
+                }
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+
+                STORM_LOG_ASSERT(aborted || numberOfSolvedSccs == numberOfSccs, "Not all SCCs were solved.");
+                return !aborted;
+            }
+
+            uint64_t SccTaskGraph::getNumberOfSccs() const {
+                return sccSizes.size();
+            }
+
+            std::unique_ptr<SccTaskGraph> createSccTaskGraph(storm::storage::SparseMatrix<double> const& matrix, storm::storage::StronglyConnectedComponentDecomposition<double> const& sccDecomposition) {
+                return std::make_unique<SccTaskGraph>(matrix, sccDecomposition);
+            }
+
+            template SccTaskGraph::SccTaskGraph(storm::storage::SparseMatrix<double> const& matrix, storm::storage::StronglyConnectedComponentDecomposition<double> const& sccDecomposition);
+        }
+    }
+}
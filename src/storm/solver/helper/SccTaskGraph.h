@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace storm {
+
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+
+        template<typename ValueType>
+        class StronglyConnectedComponentDecomposition;
+    }
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Captures the dependencies between the SCCs of an equation system, where an SCC depends on all SCCs that
+             * it reaches via a single transition. SCCs can then be solved by multiple threads, where each SCC is solved
+             * as soon as all SCCs it depends on are solved.
+             */
+            class SccTaskGraph {
+            public:
+                /*!
+                 * Creates the task graph for the given SCC decomposition of the given matrix.
+                 */
+                template<typename ValueType>
+                SccTaskGraph(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition);
+
+                /*!
+                 * Invokes the given function for all SCCs such that the function is only invoked for an SCC once it
+                 * returned for all SCCs the SCC depends on. Ready SCCs are handed to the threads in batches that
+                 * consist of either a single large SCC or multiple small (e.g. trivial) ones.
+                 *
+                 * @param numberOfThreads The number of threads that invoke the function.
+                 * @param minimalBatchSize The number of states from which on a batch is not extended by further SCCs.
+                 * @param solveScc The function to invoke. Its arguments are the index of the calling thread (which is
+                 * smaller than the number of threads) and the index of the SCC. An exception thrown by this function
+                 * stops the remaining threads and is rethrown.
+                 * @return False iff the execution was aborted before all SCCs were processed.
+                 */
+                bool execute(uint64_t numberOfThreads, uint64_t minimalBatchSize, std::function<void(uint64_t, uint64_t)> const& solveScc) const;
+
+                /*!
+                 * Retrieves the number of SCCs.
+                 */
+                uint64_t getNumberOfSccs() const;
+
+            private:
+                // The number of states of each SCC.
+                std::vector<uint64_t> sccSizes;
+
+                // The number of SCCs each SCC depends on.
+                std::vector<uint64_t> numberOfDependencies;
+
+                // The SCCs that depend on SCC i are stored in the range [dependentIndices[i], dependentIndices[i + 1]) of dependents.
+                std::vector<uint64_t> dependentIndices;
+                std::vector<uint64_t> dependents;
+            };
+
+            /*!
+             * Creates the task graph for the given SCC decomposition of the given matrix. SCCs are only solved
+             * concurrently for floating-point values, so no task graph is created for other value types.
+             *
+             * @return The task graph or null if the value type is not supported.
+             */
+            template<typename ValueType>
+            std::unique_ptr<SccTaskGraph> createSccTaskGraph(storm::storage::SparseMatrix<ValueType> const&, storm::storage::StronglyConnectedComponentDecomposition<ValueType> const&) {
+                return nullptr;
+            }
+
+            std::unique_ptr<SccTaskGraph> createSccTaskGraph(storm::storage::SparseMatrix<double> const& matrix, storm::storage::StronglyConnectedComponentDecomposition<double> const& sccDecomposition);
+
+        }
+    }
+}
@@ -0,0 +1,106 @@
+#include "storm/storage/BitVectorDeque.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        BitVectorDeque<ValueType>::BitVectorDeque(uint64_t bitsPerEntry, uint64_t initialCapacity) : wordsPerEntry(bitsPerEntry >> 6), head(0), numberOfEntries(0) {
+            STORM_LOG_ASSERT((bitsPerEntry & 63) == 0, "Entry size must be a multiple of 64.");
+            uint64_t capacity = 1;
+            while (capacity < initialCapacity) {
+                capacity <<= 1;
+            }
+            words.resize(capacity * wordsPerEntry);
+            values.resize(capacity);
+        }
+
+        template<typename ValueType>
+        void BitVectorDeque<ValueType>::pushFront(storm::storage::BitVector const& bitVector, ValueType const& value) {
+            ensureCapacity();
+            head = (head + values.size() - 1) & (values.size() - 1);
+            write(head, bitVector);
+            values[head] = value;
+            ++numberOfEntries;
+        }
+
+        template<typename ValueType>
+        void BitVectorDeque<ValueType>::pushBack(storm::storage::BitVector const& bitVector, ValueType const& value) {
+            ensureCapacity();
+            uint64_t slot = (head + numberOfEntries) & (values.size() - 1);
+            write(slot, bitVector);
+            values[slot] = value;
+            ++numberOfEntries;
+        }
+
+        template<typename ValueType>
+        void BitVectorDeque<ValueType>::getFront(storm::storage::BitVector& bitVector) const {
+            STORM_LOG_ASSERT(!empty(), "Cannot access the front of an empty queue.");
+            if (bitVector.size() != wordsPerEntry << 6) {
+                bitVector = storm::storage::BitVector(wordsPerEntry << 6);
+            }
+            uint64_t const* entry = words.data() + head * wordsPerEntry;
+            for (uint64_t word = 0; word < wordsPerEntry; ++word) {
+                bitVector.setFromInt(word << 6, 64, entry[word]);
+            }
+        }
+
+        template<typename ValueType>
+        ValueType const& BitVectorDeque<ValueType>::getFrontValue() const {
+            STORM_LOG_ASSERT(!empty(), "Cannot access the front of an empty queue.");
+            return values[head];
+        }
+
+        template<typename ValueType>
+        void BitVectorDeque<ValueType>::popFront() {
+            STORM_LOG_ASSERT(!empty(), "Cannot remove the front of an empty queue.");
+            head = (head + 1) & (values.size() - 1);
+            --numberOfEntries;
+        }
+
+        template<typename ValueType>
+        bool BitVectorDeque<ValueType>::empty() const {
+            return numberOfEntries == 0;
+        }
+
+        template<typename ValueType>
+        uint64_t BitVectorDeque<ValueType>::size() const {
+            return numberOfEntries;
+        }
+
+        template<typename ValueType>
+        void BitVectorDeque<ValueType>::write(uint64_t slot, storm::storage::BitVector const& bitVector) {
+            STORM_LOG_ASSERT(bitVector.size() == wordsPerEntry << 6, "Bit vector has illegal size " << bitVector.size() << ".");
+            uint64_t* entry = words.data() + slot * wordsPerEntry;
+            for (uint64_t word = 0; word < wordsPerEntry; ++word) {
+                entry[word] = bitVector.getAsInt(word << 6, 64);
+            }
+        }
+
+        template<typename ValueType>
+        void BitVectorDeque<ValueType>::ensureCapacity() {
+            if (numberOfEntries < values.size()) {
+                return;
+            }
+
+            // Double the capacity and move the entries such that the front entry is stored in the first slot.
+            uint64_t capacity = values.size();
+            std::vector<uint64_t> newWords(2 * capacity * wordsPerEntry);
+            std::vector<ValueType> newValues(2 * capacity);
+            for (uint64_t index = 0; index < numberOfEntries; ++index) {
+                uint64_t slot = (head + index) & (capacity - 1);
+                std::copy_n(words.begin() + slot * wordsPerEntry, wordsPerEntry, newWords.begin() + index * wordsPerEntry);
+                newValues[index] = values[slot];
+            }
+            words = std::move(newWords);
+            values = std::move(newValues);
+            head = 0;
+        }
+
+        template class BitVectorDeque<uint32_t>;
+        template class BitVectorDeque<uint64_t>;
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents a double-ended queue of bit vectors of equal size, each of which is annotated with a
+         * value. The bit vectors are stored inline in one contiguous circular buffer, so inserting and removing
+         * elements does not allocate memory for individual bit vectors. The size of the bit vectors must be a multiple
+         * of 64.
+         */
+        template<typename ValueType>
+        class BitVectorDeque {
+        public:
+            /*!
+             * Creates an empty queue.
+             *
+             * @param bitsPerEntry The size of the bit vectors that are stored. This value must be a multiple of 64.
+             * @param initialCapacity The number of entries for which storage is initially reserved.
+             */
+            BitVectorDeque(uint64_t bitsPerEntry = 64, uint64_t initialCapacity = 1024);
+
+            /*!
+             * Inserts the given bit vector and value at the front of the queue.
+             */
+            void pushFront(storm::storage::BitVector const& bitVector, ValueType const& value);
+
+            /*!
+             * Inserts the given bit vector and value at the back of the queue.
+             */
+            void pushBack(storm::storage::BitVector const& bitVector, ValueType const& value);
+
+            /*!
+             * Copies the bit vector at the front of the queue into the given bit vector. If the given bit vector
+             * already has the right size, no memory is allocated.
+             *
+             * @param bitVector The bit vector into which to copy the front entry.
+             */
+            void getFront(storm::storage::BitVector& bitVector) const;
+
+            /*!
+             * Retrieves the value associated with the bit vector at the front of the queue.
+             */
+            ValueType const& getFrontValue() const;
+
+            /*!
+             * Removes the entry at the front of the queue.
+             */
+            void popFront();
+
+            /*!
+             * Retrieves whether the queue is empty.
+             */
+            bool empty() const;
+
+            /*!
+             * Retrieves the number of entries in the queue.
+             */
+            uint64_t size() const;
+
+        private:
+            /*!
+             * Writes the given bit vector to the given slot of the buffer.
+             */
+            void write(uint64_t slot, storm::storage::BitVector const& bitVector);
+
+            /*!
+             * Doubles the capacity of the buffer if it is full.
+             */
+            void ensureCapacity();
+
+            // The number of 64-bit words per entry.
+            uint64_t wordsPerEntry;
+
+            // The circular buffer holding the words of the bit vectors. Its number of entries is a power of two.
+            std::vector<uint64_t> words;
+
+            // The values associated with the entries.
+            std::vector<ValueType> values;
+
+            // The slot of the front entry.
+            uint64_t head;
+
+            // The number of entries in the queue.
+            uint64_t numberOfEntries;
+        };
+
+    }
+}
@@ -31,10 +31,10 @@ namespace storm {
             }
             
             void increase(uint64_t element) {
-                uint64_t position = positions[element];
-                if (position >= container.size()) {
+                if (!contains(element)) {
                     return;
                 }
+                uint64_t position = positions[element];
                 
                 uint64_t parentPosition = (position - 1) / 2;
                 while (position > 0 && compare(container[parentPosition], container[position])) {
@@ -49,7 +49,8 @@ namespace storm {
             }
             
             bool contains(uint64_t element) const {
-                return positions[element] < container.size();
+                // Removed elements keep their last position, which may be taken by another element in the meantime.
+                return positions[element] < container.size() && container[positions[element]] == element;
             }
             
             bool empty() const {
@@ -65,8 +66,10 @@ namespace storm {
             }
 
             void push(uint64_t const& item) {
+                STORM_LOG_ASSERT(!contains(item), "Element is already contained.");
+                positions[item] = container.size();
                 container.emplace_back(item);
-                std::push_heap(container.begin(), container.end(), compare);
+                increase(item);
             }
             
             void pop() {
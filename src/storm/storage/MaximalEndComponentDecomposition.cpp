@@ -1,5 +1,5 @@
+#include <iterator>
 #include <list>
-#include <queue>
 #include <numeric>
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -7,6 +7,10 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+
+#include "storm/utility/NumberTraits.h"
+
 namespace storm {
     namespace storage {
         
@@ -22,18 +26,18 @@ namespace storm {
         }
 
         template<typename ValueType>
-        MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions) {
-            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions);
+        MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, bool parallelize) {
+            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, nullptr, nullptr, parallelize);
         }
         
         template<typename ValueType>
-        MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states) {
-            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states);
+        MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, bool parallelize) {
+            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, nullptr, parallelize);
         }
         
         template<typename ValueType>
-        MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, storm::storage::BitVector const& choices) {
-            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, &choices);
+        MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, storm::storage::BitVector const& choices, bool parallelize) {
+            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, &choices, parallelize);
         }
         
         template<typename ValueType>
@@ -63,61 +67,61 @@ namespace storm {
             return *this;
         }
         
-        template <typename ValueType>
-        void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states, storm::storage::BitVector const* choices) {
-            // Get some data for convenient access.
-            uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
-            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
+        namespace {
+            /*!
+             * The outcome of refining a single MEC candidate.
+             */
+            struct MecCandidateRefinement {
+                // Whether the candidate itself is an MEC.
+                bool candidateIsEndComponent = false;
+                
+                // If the candidate is not an MEC, the SCCs that replace it together with whether they are MECs (or need to be refined further).
+                std::vector<std::pair<StateBlock, bool>> components;
+                
+                // The choices that leave the SCC of their state.
+                std::vector<uint_fast64_t> removedChoices;
+            };
             
-            // Initialize the maximal end component list to be the full state space.
-            std::list<StateBlock> endComponentStateSets;
-            if (states) {
-                endComponentStateSets.emplace_back(states->begin(), states->end(), true);
-            } else {
-                std::vector<storm::storage::sparse::state_type> allStates;
-                allStates.resize(transitionMatrix.getRowGroupCount());
-                std::iota(allStates.begin(), allStates.end(), 0);
-                endComponentStateSets.emplace_back(allStates.begin(), allStates.end(), true);
-            }
-            storm::storage::BitVector statesToCheck(numberOfStates);
-            storm::storage::BitVector includedChoices;
-            if (choices) {
-                includedChoices = *choices;
-            } else if (states) {
-                includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount());
-                for (auto state : *states) {
-                    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                        includedChoices.set(choice, true);
-                    }
+            /*!
+             * Auxiliary data for refining MEC candidates. Each thread uses its own workspace for all candidates it refines.
+             */
+            struct MecCandidateRefinementWorkspace {
+                MecCandidateRefinementWorkspace(uint_fast64_t numberOfStates, uint_fast64_t numberOfChoices) : candidateStates(numberOfStates), statesToCheck(numberOfStates), statesToRemove(numberOfStates), removedChoices(numberOfChoices) {
+                    // Intentionally left empty.
                 }
-            } else {
-                includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
-            }
-            storm::storage::BitVector currMecAsBitVector(transitionMatrix.getRowGroupCount());
-                        
-            for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
-                StateBlock const& mec = *mecIterator;
-                currMecAsBitVector.clear();
-                currMecAsBitVector.set(mec.begin(), mec.end(), true);
-                // Keep track of whether the MEC changed during this iteration.
-                bool mecChanged = false;
-                
-                // Get an SCC decomposition of the current MEC candidate.
                 
-                StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&currMecAsBitVector).choices(&includedChoices).dropNaiveSccs());
+                storm::storage::BitVector candidateStates;
+                storm::storage::BitVector statesToCheck;
+                storm::storage::BitVector statesToRemove;
+                storm::storage::BitVector removedChoices;
+            };
+            
+            /*!
+             * Decomposes the given MEC candidate into SCCs and removes the states that can not stay within their SCC.
+             * An SCC is an MEC if it neither lost a state nor a choice that connects two of its states. Otherwise, it is a
+             * new candidate, as it might not be strongly connected any more.
+             *
+             * @param includedChoices The choices that are still included. These are only read, so candidates can be
+             * refined concurrently; the choices removed from the given candidate are reported in the result instead.
+             */
+            template <typename ValueType>
+            void refineMecCandidate(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const* choices, storm::storage::BitVector const& includedChoices, StateBlock const& candidate, MecCandidateRefinementWorkspace& workspace, MecCandidateRefinement& result) {
+                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
+                workspace.candidateStates.clear();
+                workspace.candidateStates.set(candidate.begin(), candidate.end(), true);
                 
-                // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
-                // the MEC canditate itself.
-                mecChanged |= sccs.size() != 1 || (sccs.size() > 0 && sccs[0].size() < mec.size());
+                // Get an SCC decomposition of the current MEC candidate.
+                StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&workspace.candidateStates).choices(&includedChoices).dropNaiveSccs());
                 
                 // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
                 for (auto& scc : sccs) {
-                    statesToCheck.set(scc.begin(), scc.end());
+                    bool sccChanged = false;
+                    workspace.statesToCheck.set(scc.begin(), scc.end());
                     
-                    while (!statesToCheck.empty()) {
-                        storm::storage::BitVector statesToRemove(numberOfStates);
+                    while (!workspace.statesToCheck.empty()) {
+                        workspace.statesToRemove.clear();
                         
-                        for (auto state : statesToCheck) {
+                        for (auto state : workspace.statesToCheck) {
                             bool keepStateInMEC = false;
                             
                             for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
@@ -126,9 +130,9 @@ namespace storm {
                                 if (choices && !choices->get(choice)) {
                                     continue;
                                 }
-
+                                
                                 // If the choice is not included any more, skip it.
-                                if (!includedChoices.get(choice)) {
+                                if (!includedChoices.get(choice) || workspace.removedChoices.get(choice)) {
                                     continue;
                                 }
                                 
@@ -137,9 +141,8 @@ namespace storm {
                                     if (storm::utility::isZero(entry.getValue())) {
                                         continue;
                                     }
-                                        
+                                    
                                     if (!scc.containsState(entry.getColumn())) {
-                                        includedChoices.set(choice, false);
                                         choiceContainedInMEC = false;
                                         break;
                                     }
@@ -148,50 +151,146 @@ namespace storm {
                                 // If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
                                 if (choiceContainedInMEC) {
                                     keepStateInMEC = true;
+                                } else {
+                                    workspace.removedChoices.set(choice, true);
+                                    result.removedChoices.push_back(choice);
+                                    
+                                    // The SCC might not be strongly connected without the choice if it also leads to a state of the SCC.
+                                    if (!sccChanged) {
+                                        for (auto const& entry : transitionMatrix.getRow(choice)) {
+                                            if (!storm::utility::isZero(entry.getValue()) && scc.containsState(entry.getColumn())) {
+                                                sccChanged = true;
+                                                break;
+                                            }
+                                        }
+                                    }
                                 }
                             }
                             
                             if (!keepStateInMEC) {
-                                statesToRemove.set(state, true);
+                                workspace.statesToRemove.set(state, true);
                             }
                         }
                         
                         // Now erase the states that have no option to stay inside the MEC with all successors.
-                        mecChanged |= !statesToRemove.empty();
-                        for (uint_fast64_t state : statesToRemove) {
+                        sccChanged |= !workspace.statesToRemove.empty();
+                        for (uint_fast64_t state : workspace.statesToRemove) {
                             scc.erase(state);
                         }
                         
                         // Now check which states should be reconsidered, because successors of them were removed.
-                        statesToCheck.clear();
-                        for (auto state : statesToRemove) {
+                        workspace.statesToCheck.clear();
+                        for (auto state : workspace.statesToRemove) {
                             for (auto const& entry : backwardTransitions.getRow(state)) {
                                 if (scc.containsState(entry.getColumn())) {
-                                    statesToCheck.set(entry.getColumn());
+                                    workspace.statesToCheck.set(entry.getColumn());
                                 }
                             }
                         }
                     }
+                    
+                    if (!sccChanged && scc.size() == candidate.size()) {
+                        // The SCC coincides with the candidate.
+                        result.candidateIsEndComponent = true;
+                    } else if (!scc.empty()) {
+                        result.components.emplace_back(std::move(scc), !sccChanged);
+                    }
                 }
                 
-                // If the MEC changed, we delete it from the list of MECs and append the possible new MEC candidates to
-                // the list instead.
-                if (mecChanged) {
-                    for (StronglyConnectedComponent& scc : sccs) {
-                        if (!scc.empty()) {
-                            endComponentStateSets.push_back(std::move(scc));
-                        }
+                // Reset the workspace for the next candidate.
+                for (auto choice : result.removedChoices) {
+                    workspace.removedChoices.set(choice, false);
+                }
+            }
+        }
+        
+        template <typename ValueType>
+        void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const* states, storm::storage::BitVector const* choices, bool parallelize) {
+            // Get some data for convenient access.
+            uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
+            
+            // Initialize the maximal end component candidate to be the full state space.
+            StateBlock initialCandidate;
+            if (states) {
+                initialCandidate = StateBlock(states->begin(), states->end(), true);
+            } else {
+                std::vector<storm::storage::sparse::state_type> allStates;
+                allStates.resize(transitionMatrix.getRowGroupCount());
+                std::iota(allStates.begin(), allStates.end(), 0);
+                initialCandidate = StateBlock(allStates.begin(), allStates.end(), true);
+            }
+            storm::storage::BitVector includedChoices;
+            if (choices) {
+                includedChoices = *choices;
+            } else if (states) {
+                includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount());
+                for (auto state : *states) {
+                    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                        includedChoices.set(choice, true);
                     }
-                    
-                    std::list<StateBlock>::const_iterator eraseIterator(mecIterator);
-                    ++mecIterator;
-                    endComponentStateSets.erase(eraseIterator);
+                }
+            } else {
+                includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
+            }
+            
+#ifdef STORM_HAVE_INTELTBB
+            parallelize = parallelize && storm::NumberTraits<ValueType>::SupportsConcurrency;
+            tbb::enumerable_thread_specific<MecCandidateRefinementWorkspace> threadWorkspaces([&] () { return MecCandidateRefinementWorkspace(numberOfStates, transitionMatrix.getRowCount()); });
+#else
+            parallelize = false;
+#endif
+            MecCandidateRefinementWorkspace workspace(parallelize ? 0 : numberOfStates, parallelize ? 0 : transitionMatrix.getRowCount());
+            
+            // Refine the candidates in rounds. Within a round, the candidates are independent of each other, as they are
+            // disjoint and only the choices of their own states are removed. A candidate that is no MEC is replaced by
+            // its SCCs, of which only the ones that changed are decomposed again in the next round.
+            std::list<StateBlock> endComponentStateSets;
+            std::vector<std::list<StateBlock>::iterator> candidates;
+            endComponentStateSets.push_back(std::move(initialCandidate));
+            candidates.push_back(endComponentStateSets.begin());
+            while (!candidates.empty()) {
+                std::vector<MecCandidateRefinement> refinements(candidates.size());
+#ifdef STORM_HAVE_INTELTBB
+                if (parallelize && candidates.size() > 1) {
+                    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, candidates.size()), [&] (tbb::blocked_range<uint_fast64_t> const& range) {
+                        MecCandidateRefinementWorkspace& localWorkspace = threadWorkspaces.local();
+                        for (uint_fast64_t candidateIndex = range.begin(); candidateIndex < range.end(); ++candidateIndex) {
+                            refineMecCandidate(transitionMatrix, backwardTransitions, choices, includedChoices, *candidates[candidateIndex], localWorkspace, refinements[candidateIndex]);
+                        }
+                    });
                 } else {
-                    // Otherwise, we proceed with the next MEC candidate.
-                    ++mecIterator;
+                    MecCandidateRefinementWorkspace& localWorkspace = parallelize ? threadWorkspaces.local() : workspace;
+                    for (uint_fast64_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex) {
+                        refineMecCandidate(transitionMatrix, backwardTransitions, choices, includedChoices, *candidates[candidateIndex], localWorkspace, refinements[candidateIndex]);
+                    }
+                }
+#else
+                for (uint_fast64_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex) {
+                    refineMecCandidate(transitionMatrix, backwardTransitions, choices, includedChoices, *candidates[candidateIndex], workspace, refinements[candidateIndex]);
                 }
+#endif
                 
-            } // End of loop over all MEC candidates.
+                // Collect the results of this round. MEC candidates that changed are deleted from the list and their SCCs
+                // are appended instead.
+                std::vector<std::list<StateBlock>::iterator> nextCandidates;
+                for (uint_fast64_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex) {
+                    auto& refinement = refinements[candidateIndex];
+                    for (auto choice : refinement.removedChoices) {
+                        includedChoices.set(choice, false);
+                    }
+                    if (!refinement.candidateIsEndComponent) {
+                        endComponentStateSets.erase(candidates[candidateIndex]);
+                        for (auto& component : refinement.components) {
+                            endComponentStateSets.push_back(std::move(component.first));
+                            if (!component.second) {
+                                nextCandidates.push_back(std::prev(endComponentStateSets.end()));
+                            }
+                        }
+                    }
+                }
+                candidates = std::move(nextCandidates);
+            }
             
             // Now that we computed the underlying state sets of the MECs, we need to properly identify the choices
             // contained in the MEC and store them as actual MECs.
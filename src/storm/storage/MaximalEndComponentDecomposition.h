@@ -32,8 +32,10 @@ namespace storm  {
              *
              * @param transitionMatrix The transition relation of model to decompose into MECs.
              * @param backwardTransition The reversed transition relation.
+             * @param parallelize If set, the MEC candidates are refined in parallel (only for floating-point values and if
+             * Storm was built with Intel TBB).
              */
-            MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions);
+            MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, bool parallelize = false);
 
             /*
              * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix).
@@ -41,8 +43,10 @@ namespace storm  {
              * @param transitionMatrix The transition relation of model to decompose into MECs.
              * @param backwardTransition The reversed transition relation.
              * @param states The states of the subsystem to decompose.
+             * @param parallelize If set, the MEC candidates are refined in parallel (only for floating-point values and if
+             * Storm was built with Intel TBB).
              */
-            MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states);
+            MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, bool parallelize = false);
 
             /*
              * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix).
@@ -51,8 +55,10 @@ namespace storm  {
              * @param backwardTransition The reversed transition relation.
              * @param states The states of the subsystem to decompose.
              * @param choices The choices of the subsystem to decompose.
+             * @param parallelize If set, the MEC candidates are refined in parallel (only for floating-point values and if
+             * Storm was built with Intel TBB).
              */
-            MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, storm::storage::BitVector const& choices);
+            MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, storm::storage::BitVector const& choices, bool parallelize = false);
 
             /*!
              * Creates an MEC decomposition of the given subsystem in the given model.
@@ -99,8 +105,9 @@ namespace storm  {
              * @param backwardTransitions The reversed transition relation.
              * @param states The states of the subsystem to decompose.
              * @param choices The choices of the subsystem to decompose.
+             * @param parallelize Whether the MEC candidates are refined in parallel.
              */
-            void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states = nullptr, storm::storage::BitVector const* choices = nullptr);
+            void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const* states = nullptr, storm::storage::BitVector const* choices = nullptr, bool parallelize = false);
         };
     }
 }
@@ -18,6 +18,7 @@
 #include "storm/utility/macros.h"
 
 #include <iterator>
+#include <numeric>
 
 namespace storm {
     namespace storage {
@@ -80,13 +81,14 @@ namespace storm {
         }
         
         template<typename ValueType>
-        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(index_type rows, index_type columns, index_type entries, bool forceDimensions, bool hasCustomRowGrouping, index_type rowGroups) : initialRowCountSet(rows != 0), initialRowCount(rows), initialColumnCountSet(columns != 0), initialColumnCount(columns), initialEntryCountSet(entries != 0), initialEntryCount(entries), forceInitialDimensions(forceDimensions), hasCustomRowGrouping(hasCustomRowGrouping), initialRowGroupCountSet(rowGroups != 0), initialRowGroupCount(rowGroups), rowGroupIndices(), columnsAndValues(), rowIndications(), currentEntryCount(0), lastRow(0), lastColumn(0), highestColumn(0), currentRowGroupCount(0) {
+        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(index_type rows, index_type columns, index_type entries, bool forceDimensions, bool hasCustomRowGrouping, index_type rowGroups) : initialRowCountSet(rows != 0), initialRowCount(rows), initialColumnCountSet(columns != 0), initialColumnCount(columns), initialEntryCountSet(entries != 0), initialEntryCount(entries), forceInitialDimensions(forceDimensions), hasCustomRowGrouping(hasCustomRowGrouping), initialRowGroupCountSet(rowGroups != 0), initialRowGroupCount(rowGroups), rowGroupIndices(), columnsAndValues(), lastChunkOffset(0), rowIndications(), currentEntryCount(0), lastRow(0), lastColumn(0), highestColumn(0), currentRowGroupCount(0) {
             // Prepare the internal storage.
             if (initialRowCountSet) {
                 rowIndications.reserve(initialRowCount + 1);
             }
             if (initialEntryCountSet) {
-                columnsAndValues.reserve(initialEntryCount);
+                columnsAndValues.emplace_back();
+                columnsAndValues.back().reserve(initialEntryCount);
             }
             if (hasCustomRowGrouping) {
                 rowGroupIndices = std::vector<index_type>();
@@ -98,10 +100,13 @@ namespace storm {
         }
         
         template<typename ValueType>
-        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(SparseMatrix<ValueType>&& matrix) :  initialRowCountSet(false), initialRowCount(0), initialColumnCountSet(false), initialColumnCount(0), initialEntryCountSet(false), initialEntryCount(0), forceInitialDimensions(false), hasCustomRowGrouping(!matrix.trivialRowGrouping), initialRowGroupCountSet(false), initialRowGroupCount(0), rowGroupIndices(), columnsAndValues(std::move(matrix.columnsAndValues)), rowIndications(std::move(matrix.rowIndications)), currentEntryCount(matrix.entryCount), currentRowGroupCount() {
+        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(SparseMatrix<ValueType>&& matrix) :  initialRowCountSet(false), initialRowCount(0), initialColumnCountSet(false), initialColumnCount(0), initialEntryCountSet(false), initialEntryCount(0), forceInitialDimensions(false), hasCustomRowGrouping(!matrix.trivialRowGrouping), initialRowGroupCountSet(false), initialRowGroupCount(0), rowGroupIndices(), columnsAndValues(), lastChunkOffset(0), rowIndications(std::move(matrix.rowIndications)), currentEntryCount(matrix.entryCount), currentRowGroupCount() {
+            
+            // The entries of the matrix form the first chunk.
+            columnsAndValues.push_back(std::move(matrix.columnsAndValues));
             
             lastRow = matrix.rowCount == 0 ? 0 : matrix.rowCount - 1;
-            lastColumn = columnsAndValues.empty() ? 0 : columnsAndValues.back().getColumn();
+            lastColumn = columnsAndValues.back().empty() ? 0 : columnsAndValues.back().back().getColumn();
             highestColumn = matrix.getColumnCount() == 0 ? 0 : matrix.getColumnCount() - 1;
             
             // If the matrix has a custom row grouping, we move it and remove the last element to make it 'open' again.
@@ -123,7 +128,7 @@ namespace storm {
         void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type column, ValueType const& value) {
             // Check that we did not move backwards wrt. the row.
             STORM_LOG_THROW(row >= lastRow, storm::exceptions::InvalidArgumentException, "Adding an element in row " << row << ", but an element in row " << lastRow << " has already been added.");
-            STORM_LOG_ASSERT(columnsAndValues.size() == currentEntryCount, "Unexpected size of columnsAndValues vector.");
+            STORM_LOG_ASSERT(lastChunkOffset + (columnsAndValues.empty() ? 0 : columnsAndValues.back().size()) == currentEntryCount, "Unexpected size of columnsAndValues vector.");
             
             // Check if a diagonal entry shall be inserted before
             if (pendingDiagonalEntry) {
@@ -150,7 +155,7 @@ namespace storm {
             // If the element is in the same row and column as the previous entry, we add them up...
             // unless there is no entry in this row yet, which might happen either for the very first entry or when only a diagonal value has been added
             if (row == lastRow && column == lastColumn && rowIndications.back() < currentEntryCount) {
-                columnsAndValues.back().setValue(columnsAndValues.back().getValue() + value);
+                columnsAndValues.back().back().setValue(columnsAndValues.back().back().getValue() + value);
             } else {
                 // If we switched to another row, we have to adjust the missing entries in the row indices vector.
                 if (row != lastRow) {
@@ -163,28 +168,31 @@ namespace storm {
                 lastColumn = column;
                 
                 // Finally, set the element and increase the current size.
-                columnsAndValues.emplace_back(column, value);
+                appendEntry(column, value);
                 highestColumn = std::max(highestColumn, column);
                 ++currentEntryCount;
                 
-                // If we need to fix the row, do so now.
+                // If we need to fix the row, do so now. The row is contained in the last chunk.
                 if (fixCurrentRow) {
+                    std::vector<MatrixEntry<index_type, value_type>>& lastChunk = columnsAndValues.back();
+                    auto rowBegin = lastChunk.begin() + (rowIndications.back() - lastChunkOffset);
+                    
                     // First, we sort according to columns.
-                    std::sort(columnsAndValues.begin() + rowIndications.back(), columnsAndValues.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
+                    std::sort(rowBegin, lastChunk.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
                         return a.getColumn() < b.getColumn();
                     });
                     
                     // Then, we eliminate possible duplicate entries.
-                    auto it = std::unique(columnsAndValues.begin() + rowIndications.back(), columnsAndValues.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
+                    auto it = std::unique(rowBegin, lastChunk.end(), [] (storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
                         return a.getColumn() == b.getColumn();
                     });
                     
                     // Finally, remove the superfluous elements.
-                    std::size_t elementsToRemove = std::distance(it, columnsAndValues.end());
+                    std::size_t elementsToRemove = std::distance(it, lastChunk.end());
                     if (elementsToRemove > 0) {
                         STORM_LOG_WARN("Unordered insertion into matrix builder caused duplicate entries.");
                         currentEntryCount -= elementsToRemove;
-                        columnsAndValues.resize(columnsAndValues.size() - elementsToRemove);
+                        lastChunk.resize(lastChunk.size() - elementsToRemove);
                     }
                 }
             }
@@ -292,7 +300,57 @@ namespace storm {
                 }
             }
             
-            return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+            return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), concatenateChunks(), std::move(rowGroupIndices));
+        }
+        
+        template<typename ValueType>
+        void SparseMatrixBuilder<ValueType>::appendEntry(index_type column, ValueType const& value) {
+            if (columnsAndValues.empty() || columnsAndValues.back().size() == columnsAndValues.back().capacity()) {
+                // Chunks grow geometrically up to a fixed size. Chunks of the maximal size are large enough to be
+                // returned to the operating system when they are released.
+                index_type const minimalChunkSize = 1024;
+                index_type const maximalChunkSize = 1ull << 22;
+                index_type chunkSize = columnsAndValues.empty() ? minimalChunkSize : std::min(maximalChunkSize, std::max(minimalChunkSize, 2 * static_cast<index_type>(columnsAndValues.back().capacity())));
+                
+                // Make sure the new chunk can hold the current row, even if it is larger than a chunk.
+                index_type rowStart = rowIndications.back();
+                index_type entriesOfCurrentRow = currentEntryCount - rowStart;
+                std::vector<MatrixEntry<index_type, value_type>> chunk;
+                chunk.reserve(std::max(chunkSize, 2 * entriesOfCurrentRow + 1));
+                
+                if (!columnsAndValues.empty()) {
+                    std::vector<MatrixEntry<index_type, value_type>>& lastChunk = columnsAndValues.back();
+                    auto rowBegin = lastChunk.begin() + (rowStart - lastChunkOffset);
+                    std::move(rowBegin, lastChunk.end(), std::back_inserter(chunk));
+                    lastChunk.erase(rowBegin, lastChunk.end());
+                    if (lastChunk.empty()) {
+                        columnsAndValues.pop_back();
+                    } else {
+                        lastChunkOffset += lastChunk.size();
+                    }
+                }
+                columnsAndValues.push_back(std::move(chunk));
+            }
+            columnsAndValues.back().emplace_back(column, value);
+        }
+        
+        template<typename ValueType>
+        std::vector<MatrixEntry<typename SparseMatrixBuilder<ValueType>::index_type, ValueType>> SparseMatrixBuilder<ValueType>::concatenateChunks() {
+            std::vector<MatrixEntry<index_type, value_type>> result;
+            if (columnsAndValues.size() == 1) {
+                result = std::move(columnsAndValues.front());
+            } else if (columnsAndValues.size() > 1) {
+                // Only the pages of the result that were already written are backed by memory, so releasing the
+                // chunks one by one keeps the memory footprint at roughly the size of the result.
+                result.reserve(currentEntryCount);
+                for (auto& chunk : columnsAndValues) {
+                    std::move(chunk.begin(), chunk.end(), std::back_inserter(result));
+                    std::vector<MatrixEntry<index_type, value_type>>().swap(chunk);
+                }
+            }
+            columnsAndValues.clear();
+            lastChunkOffset = 0;
+            return result;
         }
         
         template<typename ValueType>
@@ -340,10 +398,24 @@ namespace storm {
         void SparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> const& replacements, index_type offset) {
             index_type maxColumn = 0;
             
+            uint64_t chunk = 0;
+            index_type chunkOffset = 0;
             for (index_type row = 0; row < rowIndications.size(); ++row) {
+                index_type rowStart = rowIndications[row];
+                index_type rowEnd = row < rowIndications.size() - 1 ? rowIndications[row + 1] : currentEntryCount;
+                if (rowStart == rowEnd) {
+                    continue;
+                }
+                
+                // Since rows do not span multiple chunks, the chunk of the first entry contains the whole row.
+                while (rowStart >= chunkOffset + columnsAndValues[chunk].size()) {
+                    chunkOffset += columnsAndValues[chunk].size();
+                    ++chunk;
+                }
+                
                 bool changed = false;
-                auto startRow = std::next(columnsAndValues.begin(), rowIndications[row]);
-                auto endRow = row < rowIndications.size()-1 ? std::next(columnsAndValues.begin(), rowIndications[row+1]) : columnsAndValues.end();
+                auto startRow = std::next(columnsAndValues[chunk].begin(), rowStart - chunkOffset);
+                auto endRow = std::next(startRow, rowEnd - rowStart);
                 for (auto entry = startRow; entry != endRow; ++entry) {
                     if (entry->getColumn() >= offset) {
                         // Change column
@@ -367,7 +439,7 @@ namespace storm {
             }
             
             highestColumn = maxColumn;
-            lastColumn = columnsAndValues.empty() ? 0 : columnsAndValues.back().getColumn();
+            lastColumn = currentEntryCount == 0 ? 0 : columnsAndValues.back().back().getColumn();
         }
         
         template<typename ValueType>
@@ -1091,6 +1163,69 @@ namespace storm {
             return matrixBuilder.build();
         }
         
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::setToBlockSubmatrix(SparseMatrix<ValueType> const& matrix, std::vector<index_type> const& rowGroups, std::vector<index_type> const& blockOfColumn, index_type block, std::vector<index_type> const& indexInBlock, bool insertDiagonalEntries) {
+            STORM_LOG_ASSERT(this != &matrix, "Cannot overwrite a matrix with one of its submatrices.");
+            STORM_LOG_THROW(!rowGroups.empty(), storm::exceptions::InvalidArgumentException, "Cannot build empty submatrix.");
+            
+            // Retrieving the row group indices of a matrix with trivial row grouping would create them, which must
+            // not happen here as the given matrix might be accessed concurrently.
+            bool hasCustomRowGrouping = !matrix.hasTrivialRowGrouping();
+            
+            // Clearing the vectors keeps their capacity.
+            this->columnsAndValues.clear();
+            this->rowIndications.clear();
+            this->rowIndications.push_back(0);
+            if (hasCustomRowGrouping) {
+                if (!this->rowGroupIndices) {
+                    this->rowGroupIndices = std::vector<index_type>();
+                }
+                this->rowGroupIndices->clear();
+                this->rowGroupIndices->push_back(0);
+            }
+            
+            index_type newRowGroup = 0;
+            for (auto const& rowGroup : rowGroups) {
+                STORM_LOG_ASSERT(blockOfColumn[rowGroup] == block && indexInBlock[rowGroup] == newRowGroup, "Row group " << rowGroup << " does not match the given block.");
+                index_type firstRow = hasCustomRowGrouping ? matrix.getRowGroupIndices()[rowGroup] : rowGroup;
+                index_type endRow = hasCustomRowGrouping ? matrix.getRowGroupIndices()[rowGroup + 1] : rowGroup + 1;
+                for (index_type row = firstRow; row < endRow; ++row) {
+                    bool hasDiagonalEntry = false;
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (blockOfColumn[entry.getColumn()] == block) {
+                            index_type column = indexInBlock[entry.getColumn()];
+                            if (insertDiagonalEntries && !hasDiagonalEntry && column >= newRowGroup) {
+                                if (column > newRowGroup) {
+                                    this->columnsAndValues.emplace_back(newRowGroup, storm::utility::zero<ValueType>());
+                                }
+                                hasDiagonalEntry = true;
+                            }
+                            this->columnsAndValues.emplace_back(column, entry.getValue());
+                        }
+                    }
+                    if (insertDiagonalEntries && !hasDiagonalEntry) {
+                        this->columnsAndValues.emplace_back(newRowGroup, storm::utility::zero<ValueType>());
+                    }
+                    this->rowIndications.push_back(this->columnsAndValues.size());
+                }
+                if (hasCustomRowGrouping) {
+                    this->rowGroupIndices->push_back(this->rowIndications.size() - 1);
+                }
+                ++newRowGroup;
+            }
+            
+            this->rowCount = this->rowIndications.size() - 1;
+            this->columnCount = rowGroups.size();
+            this->entryCount = this->columnsAndValues.size();
+            this->trivialRowGrouping = !hasCustomRowGrouping;
+            if (this->trivialRowGrouping && this->rowGroupIndices) {
+                // Keep the row group indices that were requested from the outside up to date.
+                this->rowGroupIndices->resize(this->rowCount + 1);
+                std::iota(this->rowGroupIndices->begin(), this->rowGroupIndices->end(), 0);
+            }
+            this->updateNonzeroEntryCount();
+        }
+        
         template<typename ValueType>
         SparseMatrix<ValueType> SparseMatrix<ValueType>::restrictRows(storm::storage::BitVector const& rowsToKeep, bool allowEmptyRowGroups) const {
             STORM_LOG_ASSERT(rowsToKeep.size() == this->getRowCount(), "Dimensions mismatch.");
@@ -1229,6 +1364,107 @@ namespace storm {
             return matrixBuilder.build();
         }
 
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::updateRowsFromRowGroups(SparseMatrix<ValueType> const& matrix, std::vector<index_type> const& rowGroupToRowIndexMapping, std::vector<index_type> const& changedRowGroups, bool insertDiagonalEntries, bool convertToEquationSystem) {
+            STORM_LOG_ASSERT(this != &matrix, "Cannot select rows of a matrix from itself.");
+            STORM_LOG_ASSERT(!convertToEquationSystem || insertDiagonalEntries, "Equation systems need diagonal entries.");
+            STORM_LOG_ASSERT(this->hasTrivialRowGrouping() && this->getRowCount() == matrix.getRowGroupCount(), "The matrix does not select one row of each row group of the given matrix.");
+            STORM_LOG_ASSERT(std::is_sorted(changedRowGroups.begin(), changedRowGroups.end()), "The changed row groups are not sorted.");
+            if (changedRowGroups.empty()) {
+                return;
+            }
+            
+            // Determine how far the entries behind each changed row have to be moved. The number of nonzero entries is
+            // updated with the entries of the changed rows to avoid a pass over the whole matrix.
+            std::vector<int64_t> shifts;
+            shifts.reserve(changedRowGroups.size());
+            int64_t shift = 0;
+            for (auto const& rowGroup : changedRowGroups) {
+                for (auto const& entry : this->getRow(rowGroup)) {
+                    if (!storm::utility::isZero(entry.getValue())) {
+                        --this->nonzeroEntryCount;
+                    }
+                }
+                index_type rowToCopy = matrix.getRowGroupIndices()[rowGroup] + rowGroupToRowIndexMapping[rowGroup];
+                int64_t newLength = matrix.getRow(rowToCopy).getNumberOfEntries();
+                if (insertDiagonalEntries && std::none_of(matrix.begin(rowToCopy), matrix.end(rowToCopy), [&rowGroup] (MatrixEntry<index_type, ValueType> const& entry) { return entry.getColumn() == rowGroup; })) {
+                    ++newLength;
+                }
+                shift += newLength - static_cast<int64_t>(this->rowIndications[rowGroup + 1] - this->rowIndications[rowGroup]);
+                shifts.push_back(shift);
+            }
+            
+            // Move the unchanged rows between the changed rows. As the rows keep their order, entries that are moved to
+            // the front (back) never overwrite entries to their right (left) that still need to be moved. We therefore
+            // move the former from front to back and then the latter from back to front.
+            index_type oldEntryCount = this->columnsAndValues.size();
+            index_type newEntryCount = oldEntryCount + shift;
+            if (newEntryCount > oldEntryCount) {
+                this->columnsAndValues.resize(newEntryCount);
+            }
+            auto getSegmentBegin = [&] (uint64_t index) { return this->columnsAndValues.begin() + this->rowIndications[changedRowGroups[index] + 1]; };
+            auto getSegmentEnd = [&] (uint64_t index) { return this->columnsAndValues.begin() + (index + 1 < changedRowGroups.size() ? this->rowIndications[changedRowGroups[index + 1]] : oldEntryCount); };
+            for (uint64_t index = 0; index < changedRowGroups.size(); ++index) {
+                if (shifts[index] < 0) {
+                    std::move(getSegmentBegin(index), getSegmentEnd(index), getSegmentBegin(index) + shifts[index]);
+                }
+            }
+            for (uint64_t index = changedRowGroups.size(); index > 0; --index) {
+                if (shifts[index - 1] > 0) {
+                    std::move_backward(getSegmentBegin(index - 1), getSegmentEnd(index - 1), getSegmentEnd(index - 1) + shifts[index - 1]);
+                }
+            }
+            
+            // Update the row indications. The end of each changed row is moved like the rows behind it.
+            for (uint64_t index = 0; index < changedRowGroups.size(); ++index) {
+                index_type lastRow = index + 1 < changedRowGroups.size() ? changedRowGroups[index + 1] : this->rowCount;
+                for (index_type row = changedRowGroups[index] + 1; row <= lastRow; ++row) {
+                    this->rowIndications[row] += shifts[index];
+                }
+            }
+            
+            // Finally, copy the new rows to their place. This also inserts a zero element on the diagonal if there is no entry yet.
+            for (auto const& rowGroup : changedRowGroups) {
+                index_type rowToCopy = matrix.getRowGroupIndices()[rowGroup] + rowGroupToRowIndexMapping[rowGroup];
+                auto targetIt = this->columnsAndValues.begin() + this->rowIndications[rowGroup];
+                bool insertedDiagonalElement = false;
+                for (auto const& entry : matrix.getRow(rowToCopy)) {
+                    if (entry.getColumn() == rowGroup) {
+                        insertedDiagonalElement = true;
+                    } else if (insertDiagonalEntries && !insertedDiagonalElement && entry.getColumn() > rowGroup) {
+                        *targetIt = MatrixEntry<index_type, ValueType>(rowGroup, storm::utility::zero<ValueType>());
+                        ++targetIt;
+                        insertedDiagonalElement = true;
+                    }
+                    *targetIt = entry;
+                    ++targetIt;
+                }
+                if (insertDiagonalEntries && !insertedDiagonalElement) {
+                    *targetIt = MatrixEntry<index_type, ValueType>(rowGroup, storm::utility::zero<ValueType>());
+                    ++targetIt;
+                }
+                STORM_LOG_ASSERT(targetIt == this->columnsAndValues.begin() + this->rowIndications[rowGroup + 1], "Unexpected number of entries in row " << rowGroup << ".");
+                
+                for (auto& entry : this->getRow(rowGroup)) {
+                    if (convertToEquationSystem) {
+                        if (entry.getColumn() == rowGroup) {
+                            entry.setValue(storm::utility::one<ValueType>() - entry.getValue());
+                        } else {
+                            entry.setValue(-entry.getValue());
+                        }
+                    }
+                    if (!storm::utility::isZero(entry.getValue())) {
+                        ++this->nonzeroEntryCount;
+                    }
+                }
+            }
+            
+            if (newEntryCount < oldEntryCount) {
+                this->columnsAndValues.resize(newEntryCount);
+            }
+            this->entryCount = newEntryCount;
+        }
+        
         template<typename ValueType>
         SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowIndexSequence(std::vector<index_type> const& rowIndexSequence, bool insertDiagonalEntries) const{
             // First, we need to count how many non-zero entries the resulting matrix will have and reserve space for
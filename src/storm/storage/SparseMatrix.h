@@ -145,8 +145,9 @@ namespace storm {
             
             /*!
              * Constructs a sparse matrix builder producing a matrix with the given number of rows, columns and entries.
-             * The number of rows, columns and entries is reserved upon creation. If more rows/columns or entries are
-             * added, this will possibly lead to a reallocation.
+             * The number of rows, columns and entries is reserved upon creation. If more rows/columns are added, this
+             * will possibly lead to a reallocation. Additional entries are stored in further chunks, so entries are
+             * never moved once they were added (except for the entries of the row that is currently being built).
              *
              * @param rows The number of rows of the resulting matrix.
              * @param columns The number of columns of the resulting matrix.
@@ -253,6 +254,18 @@ namespace storm {
             void addDiagonalEntry(index_type row, ValueType const& value);
             
         private:
+            /*!
+             * Appends an entry to the current row. If the last chunk is full, a new chunk is opened and the entries of
+             * the current row are moved to it, such that every row is contained in a single chunk.
+             */
+            void appendEntry(index_type column, ValueType const& value);
+            
+            /*!
+             * Concatenates the chunks to the storage of the final matrix. Every chunk is released as soon as its
+             * entries were moved, which keeps the peak memory close to the size of the final matrix.
+             */
+            std::vector<MatrixEntry<index_type, value_type>> concatenateChunks();
+            
             // A flag indicating whether a row count was set upon construction.
             bool initialRowCountSet;
             
@@ -286,8 +299,13 @@ namespace storm {
             // The vector that stores the row-group indices (if they are non-trivial).
             boost::optional<std::vector<index_type>> rowGroupIndices;
             
-            // The storage for the columns and values of all entries in the matrix.
-            std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
+            // The storage for the columns and values of all entries in the matrix. The entries are stored in chunks that
+            // are never reallocated, since moving all entries to a larger vector temporarily requires up to three
+            // times the memory of the entries.
+            std::vector<std::vector<MatrixEntry<index_type, value_type>>> columnsAndValues;
+            
+            // The index of the first entry of the last chunk.
+            index_type lastChunkOffset;
             
             // A vector containing the indices at which each given row begins. This index is to be interpreted as an
             // index in the valueStorage and the columnIndications vectors. Put differently, the values of the entries
@@ -720,6 +738,24 @@ namespace storm {
              */
             SparseMatrix getSubmatrix(bool useGroups, storm::storage::BitVector const& rowConstraint, storm::storage::BitVector const& columnConstraint, bool insertDiagonalEntries = false, storm::storage::BitVector const& makeZeroColumns = storm::storage::BitVector()) const;
             
+            /*!
+             * Overwrites this matrix with the submatrix of the given matrix that consists of the given row groups and
+             * the columns that belong to the same block as these row groups. In contrast to getSubmatrix, no auxiliary
+             * data whose size depends on the dimensions of the given matrix is created and the memory already held by
+             * this matrix is reused. This makes it suitable for repeatedly extracting small blocks (e.g. SCCs) of a
+             * large matrix.
+             *
+             * @param matrix The matrix from which to take the submatrix. Must not be this matrix.
+             * @param rowGroups The row groups of the block in ascending order.
+             * @param blockOfColumn The index of the block of each column of the given matrix.
+             * @param block The index of the block given by the row groups. Only the columns of this block are kept.
+             * @param indexInBlock The index of each column of the given matrix within its block, i.e., the column of
+             * the submatrix. Within a block, the indices have to be ascending in the original columns.
+             * @param insertDiagonalEntries If set to true, the resulting matrix will have zero entries in column i for
+             * each row in row group i, if there is no value yet.
+             */
+            void setToBlockSubmatrix(SparseMatrix const& matrix, std::vector<index_type> const& rowGroups, std::vector<index_type> const& blockOfColumn, index_type block, std::vector<index_type> const& indexInBlock, bool insertDiagonalEntries = false);
+            
             /*!
              * Restrict rows in grouped rows matrix. Ensures that the number of groups stays the same. 
              * 
@@ -783,6 +819,21 @@ namespace storm {
              */
             SparseMatrix selectRowsFromRowGroups(std::vector<index_type> const& rowGroupToRowIndexMapping, bool insertDiagonalEntries = true) const;
             
+            /*!
+             * Updates this matrix, which is assumed to be obtained by selecting one row out of each row group of the
+             * given matrix (see selectRowsFromRowGroups), such that it reflects the new selection for the given row
+             * groups. Only the rows of these row groups are rewritten. If their number of entries changes, the
+             * entries of the subsequent rows are moved within the existing storage.
+             *
+             * @param matrix The matrix from which the rows are selected.
+             * @param rowGroupToRowIndexMapping The (new) selected row of each row group, relative to the row group.
+             * @param changedRowGroups The row groups whose selected row changed in ascending order.
+             * @param insertDiagonalEntries Has to match the value that was used to select the rows initially.
+             * @param convertToEquationSystem If set, the new rows are converted as by convertToEquationSystem, i.e., this
+             * matrix is assumed to be the equation system of the selected rows.
+             */
+            void updateRowsFromRowGroups(SparseMatrix const& matrix, std::vector<index_type> const& rowGroupToRowIndexMapping, std::vector<index_type> const& changedRowGroups, bool insertDiagonalEntries = true, bool convertToEquationSystem = false);
+            
             /*!
              * Selects the rows that are given by the sequence of row indices, allowing to select rows arbitrarily often and with an arbitrary order
              * The resulting matrix will have a trivial row grouping.
@@ -0,0 +1,238 @@
+#include "storm/storage/SpilledBitVectorMap.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        SpilledBitVectorMap<ValueType>::SpilledBitVectorMap(uint64_t bitsPerEntry, std::string const& directory, uint64_t numberOfPartitions, uint64_t bloomFilterBitsPerEntry) : wordsPerEntry(bitsPerEntry >> 6), wordsPerRecord(wordsPerEntry + 2), directory(directory), partitionShift(64), numberOfPartitions(numberOfPartitions), bloomFilterBitsPerEntry(bloomFilterBitsPerEntry), bloomFilterProbes(std::max<uint64_t>(1, static_cast<uint64_t>(std::round(bloomFilterBitsPerEntry * std::log(2.0))))), numberOfEntries(0), recordBuffer(wordsPerRecord) {
+            STORM_LOG_ASSERT((bitsPerEntry & 63) == 0, "Entry size must be a multiple of 64.");
+            STORM_LOG_ASSERT(numberOfPartitions > 0 && (numberOfPartitions & (numberOfPartitions - 1)) == 0, "Number of partitions must be a power of two.");
+            for (uint64_t partitions = numberOfPartitions; partitions > 1; partitions >>= 1) {
+                --partitionShift;
+            }
+
+            boost::system::error_code errorCode;
+            boost::filesystem::create_directories(directory, errorCode);
+            STORM_LOG_THROW(boost::filesystem::is_directory(directory), storm::exceptions::FileIoException, "Unable to use directory '" << directory << "' for spilling states.");
+        }
+
+        template<typename ValueType>
+        SpilledBitVectorMap<ValueType>::~SpilledBitVectorMap() {
+            for (auto& segment : segments) {
+                segment->file.close();
+                boost::system::error_code errorCode;
+                boost::filesystem::remove(segment->filename, errorCode);
+            }
+        }
+
+        template<typename ValueType>
+        void SpilledBitVectorMap<ValueType>::spill(storm::storage::BitVectorHashMap<ValueType> const& map) {
+            uint64_t entries = map.size();
+            if (entries == 0) {
+                return;
+            }
+
+            std::unique_ptr<Segment> segment = std::make_unique<Segment>();
+            segment->filename = (boost::filesystem::path(directory) / boost::filesystem::unique_path("storm-states-%%%%-%%%%-%%%%-%%%%.bin")).string();
+            segment->partitions.resize(numberOfPartitions, Partition{0, 0, storm::storage::BitVector()});
+            segment->numberOfEntries = entries;
+
+            // Collect the records along with the order in which they are written. Sorting by hash value groups the
+            // records by partition, because the partition is given by the leading bits of the hash value.
+            std::vector<uint64_t> records(entries * wordsPerRecord);
+            std::vector<uint64_t> bloomFilterHashes(entries);
+            std::vector<std::pair<uint64_t, uint64_t>> order;
+            order.reserve(entries);
+            uint64_t index = 0;
+            for (auto const& keyValuePair : map) {
+                std::pair<uint64_t, uint64_t> hashes = getHashes(keyValuePair.first);
+                uint64_t* record = records.data() + index * wordsPerRecord;
+                record[0] = hashes.first;
+                for (uint64_t word = 0; word < wordsPerEntry; ++word) {
+                    record[word + 1] = keyValuePair.first.getAsInt(word << 6, 64);
+                }
+                record[wordsPerEntry + 1] = static_cast<uint64_t>(keyValuePair.second);
+                bloomFilterHashes[index] = hashes.second;
+                order.emplace_back(hashes.first, index);
+                ++segment->partitions[getPartition(hashes.first)].numberOfEntries;
+                ++index;
+            }
+            std::sort(order.begin(), order.end());
+
+            uint64_t offset = 0;
+            for (auto& partition : segment->partitions) {
+                partition.offset = offset;
+                offset += partition.numberOfEntries;
+                if (partition.numberOfEntries > 0) {
+                    partition.bloomFilter = storm::storage::BitVector(std::max<uint64_t>(64, partition.numberOfEntries * bloomFilterBitsPerEntry));
+                }
+            }
+
+            segment->file.open(segment->filename, std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary);
+            STORM_LOG_THROW(segment->file.is_open(), storm::exceptions::FileIoException, "Unable to create file '" << segment->filename << "' for spilling states.");
+            for (auto const& hashIndexPair : order) {
+                Partition& partition = segment->partitions[getPartition(hashIndexPair.first)];
+                std::pair<uint64_t, uint64_t> hashes(hashIndexPair.first, bloomFilterHashes[hashIndexPair.second]);
+                for (uint64_t probe = 0; probe < bloomFilterProbes; ++probe) {
+                    partition.bloomFilter.set(getBloomFilterPosition(hashes, probe, partition.bloomFilter.size()));
+                }
+                segment->file.write(reinterpret_cast<char const*>(records.data() + hashIndexPair.second * wordsPerRecord), wordsPerRecord * sizeof(uint64_t));
+            }
+            segment->file.flush();
+            STORM_LOG_THROW(segment->file.good(), storm::exceptions::FileIoException, "Unable to write file '" << segment->filename << "' for spilling states.");
+
+            STORM_LOG_TRACE("Spilled " << entries << " entries to '" << segment->filename << "'.");
+            numberOfEntries += entries;
+            segments.push_back(std::move(segment));
+        }
+
+        template<typename ValueType>
+        boost::optional<ValueType> SpilledBitVectorMap<ValueType>::find(storm::storage::BitVector const& key) const {
+            if (segments.empty()) {
+                return boost::none;
+            }
+
+            std::pair<uint64_t, uint64_t> hashes = getHashes(key);
+            uint64_t partitionIndex = getPartition(hashes.first);
+            for (auto const& segment : segments) {
+                Partition const& partition = segment->partitions[partitionIndex];
+                if (partition.numberOfEntries == 0) {
+                    continue;
+                }
+
+                bool mayContain = true;
+                for (uint64_t probe = 0; probe < bloomFilterProbes; ++probe) {
+                    if (!partition.bloomFilter.get(getBloomFilterPosition(hashes, probe, partition.bloomFilter.size()))) {
+                        mayContain = false;
+                        break;
+                    }
+                }
+                if (!mayContain) {
+                    continue;
+                }
+
+                // Search the first record of the partition whose hash value is not smaller than the one of the key.
+                uint64_t low = partition.offset;
+                uint64_t high = partition.offset + partition.numberOfEntries;
+                while (low < high) {
+                    uint64_t middle = low + (high - low) / 2;
+                    readRecord(*segment, middle, recordBuffer);
+                    if (recordBuffer[0] < hashes.first) {
+                        low = middle + 1;
+                    } else {
+                        high = middle;
+                    }
+                }
+
+                // Then compare the keys of all records with an equal hash value.
+                for (uint64_t end = partition.offset + partition.numberOfEntries; low < end; ++low) {
+                    readRecord(*segment, low, recordBuffer);
+                    if (recordBuffer[0] != hashes.first) {
+                        break;
+                    }
+                    bool equal = true;
+                    for (uint64_t word = 0; word < wordsPerEntry; ++word) {
+                        if (recordBuffer[word + 1] != key.getAsInt(word << 6, 64)) {
+                            equal = false;
+                            break;
+                        }
+                    }
+                    if (equal) {
+                        return getRecordValue(recordBuffer);
+                    }
+                }
+            }
+            return boost::none;
+        }
+
+        template<typename ValueType>
+        uint64_t SpilledBitVectorMap<ValueType>::size() const {
+            return numberOfEntries;
+        }
+
+        template<typename ValueType>
+        void SpilledBitVectorMap<ValueType>::forEach(std::function<void (storm::storage::BitVector const&, ValueType const&)> const& callback) const {
+            uint64_t const recordsPerChunk = 4096;
+            std::vector<uint64_t> buffer;
+            storm::storage::BitVector key(wordsPerEntry << 6);
+            for (auto const& segment : segments) {
+                segment->file.seekg(0);
+                for (uint64_t first = 0; first < segment->numberOfEntries; first += recordsPerChunk) {
+                    uint64_t records = std::min(recordsPerChunk, segment->numberOfEntries - first);
+                    buffer.resize(records * wordsPerRecord);
+                    segment->file.read(reinterpret_cast<char*>(buffer.data()), buffer.size() * sizeof(uint64_t));
+                    STORM_LOG_THROW(segment->file.good(), storm::exceptions::FileIoException, "Unable to read spilled states from file '" << segment->filename << "'.");
+                    for (uint64_t record = 0; record < records; ++record) {
+                        uint64_t const* recordWords = buffer.data() + record * wordsPerRecord;
+                        for (uint64_t word = 0; word < wordsPerEntry; ++word) {
+                            key.setFromInt(word << 6, 64, recordWords[word + 1]);
+                        }
+                        callback(key, getRecordValue(buffer, record));
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void SpilledBitVectorMap<ValueType>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+            uint64_t const recordsPerChunk = 4096;
+            std::vector<uint64_t> buffer;
+            for (auto& segment : segments) {
+                for (uint64_t first = 0; first < segment->numberOfEntries; first += recordsPerChunk) {
+                    uint64_t records = std::min(recordsPerChunk, segment->numberOfEntries - first);
+                    std::streamoff position = first * wordsPerRecord * sizeof(uint64_t);
+                    buffer.resize(records * wordsPerRecord);
+                    segment->file.seekg(position);
+                    segment->file.read(reinterpret_cast<char*>(buffer.data()), buffer.size() * sizeof(uint64_t));
+                    for (uint64_t record = 0; record < records; ++record) {
+                        uint64_t& value = buffer[record * wordsPerRecord + wordsPerEntry + 1];
+                        value = static_cast<uint64_t>(remapping(static_cast<ValueType>(value)));
+                    }
+                    segment->file.seekp(position);
+                    segment->file.write(reinterpret_cast<char const*>(buffer.data()), buffer.size() * sizeof(uint64_t));
+                }
+                segment->file.flush();
+                STORM_LOG_THROW(segment->file.good(), storm::exceptions::FileIoException, "Unable to remap spilled states in file '" << segment->filename << "'.");
+            }
+        }
+
+        template<typename ValueType>
+        std::pair<uint64_t, uint64_t> SpilledBitVectorMap<ValueType>::getHashes(storm::storage::BitVector const& key) const {
+            // The second hash is made odd, so the probes of the Bloom filters do not collapse onto one position.
+            return std::make_pair(Murmur3BitVectorHash<uint64_t>()(key), static_cast<uint64_t>(FNV1aBitVectorHash()(key)) | 1);
+        }
+
+        template<typename ValueType>
+        uint64_t SpilledBitVectorMap<ValueType>::getPartition(uint64_t hash) const {
+            return partitionShift == 64 ? 0 : hash >> partitionShift;
+        }
+
+        template<typename ValueType>
+        uint64_t SpilledBitVectorMap<ValueType>::getBloomFilterPosition(std::pair<uint64_t, uint64_t> const& hashes, uint64_t probe, uint64_t bloomFilterSize) const {
+            return (hashes.first + probe * hashes.second) % bloomFilterSize;
+        }
+
+        template<typename ValueType>
+        void SpilledBitVectorMap<ValueType>::readRecord(Segment const& segment, uint64_t record, std::vector<uint64_t>& buffer) const {
+            segment.file.seekg(record * wordsPerRecord * sizeof(uint64_t));
+            segment.file.read(reinterpret_cast<char*>(buffer.data()), wordsPerRecord * sizeof(uint64_t));
+            STORM_LOG_THROW(segment.file.good(), storm::exceptions::FileIoException, "Unable to read spilled states from file '" << segment.filename << "'.");
+        }
+
+        template<typename ValueType>
+        ValueType SpilledBitVectorMap<ValueType>::getRecordValue(std::vector<uint64_t> const& buffer, uint64_t record) const {
+            return static_cast<ValueType>(buffer[record * wordsPerRecord + wordsPerEntry + 1]);
+        }
+
+        template class SpilledBitVectorMap<uint32_t>;
+        template class SpilledBitVectorMap<uint64_t>;
+    }
+}
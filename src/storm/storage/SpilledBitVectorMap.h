@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents a read-only map from bit vectors to values whose entries are stored in files on disk.
+         * Entries are added in bulk by spilling the contents of a BitVectorHashMap, each of which becomes a new
+         * segment. Within a segment, the entries are partitioned by a prefix of their hash value and sorted by hash,
+         * so a lookup has to touch at most one partition per segment. Every partition is guarded by an in-memory Bloom
+         * filter, such that keys that were never spilled are almost always rejected without accessing the disk. The
+         * keys must be bit vectors with a length that is a multiple of 64. All files are removed when the map is
+         * destroyed.
+         */
+        template<typename ValueType>
+        class SpilledBitVectorMap {
+        public:
+            /*!
+             * Creates an empty map.
+             *
+             * @param bitsPerEntry The size of the keys. This value must be a multiple of 64.
+             * @param directory The directory in which the segment files are created.
+             * @param numberOfPartitions The number of partitions per segment. This value must be a power of two.
+             * @param bloomFilterBitsPerEntry The number of bits of the Bloom filters per stored key. Ten bits yield
+             * a false-positive rate of roughly one percent.
+             */
+            SpilledBitVectorMap(uint64_t bitsPerEntry, std::string const& directory, uint64_t numberOfPartitions = 1024, uint64_t bloomFilterBitsPerEntry = 10);
+
+            SpilledBitVectorMap(SpilledBitVectorMap const&) = delete;
+            SpilledBitVectorMap& operator=(SpilledBitVectorMap const&) = delete;
+
+            /*!
+             * Closes and removes all segment files.
+             */
+            ~SpilledBitVectorMap();
+
+            /*!
+             * Writes all entries of the given map to a new segment on disk. The given map is not modified. The keys
+             * of the given map must not be contained in this map already.
+             *
+             * @param map The map whose entries to spill.
+             */
+            void spill(storm::storage::BitVectorHashMap<ValueType> const& map);
+
+            /*!
+             * Searches for the given key.
+             *
+             * @param key The key to search.
+             * @return The value associated with the key, if the key is contained in the map.
+             */
+            boost::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the number of entries stored in the map.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Invokes the given callback for every entry of the map. The entries are read sequentially from disk.
+             *
+             * @param callback The function to invoke on every key-value pair.
+             */
+            void forEach(std::function<void (storm::storage::BitVector const&, ValueType const&)> const& callback) const;
+
+            /*!
+             * Performs a remapping of all values stored by applying the given remapping. The segment files are
+             * rewritten in place.
+             *
+             * @param remapping The remapping to apply.
+             */
+            void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+        private:
+            struct Partition {
+                // The index of the first record of the partition in the segment file.
+                uint64_t offset;
+
+                // The number of records of the partition.
+                uint64_t numberOfEntries;
+
+                // The Bloom filter for the keys of the partition.
+                storm::storage::BitVector bloomFilter;
+            };
+
+            struct Segment {
+                // The name of the file holding the records of this segment.
+                std::string filename;
+
+                // The file holding the records. Records are stored as the hash of the key, the words of the key
+                // and the value.
+                mutable std::fstream file;
+
+                // The partitions of the segment.
+                std::vector<Partition> partitions;
+
+                // The number of records of the segment.
+                uint64_t numberOfEntries;
+            };
+
+            /*!
+             * Retrieves the two hash values of the given key that are used for partitioning and the Bloom filters.
+             */
+            std::pair<uint64_t, uint64_t> getHashes(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the partition to which a key with the given hash value belongs.
+             */
+            uint64_t getPartition(uint64_t hash) const;
+
+            /*!
+             * Retrieves the position of the given Bloom filter probe.
+             */
+            uint64_t getBloomFilterPosition(std::pair<uint64_t, uint64_t> const& hashes, uint64_t probe, uint64_t bloomFilterSize) const;
+
+            /*!
+             * Reads the record with the given index of the given segment into the given buffer.
+             */
+            void readRecord(Segment const& segment, uint64_t record, std::vector<uint64_t>& buffer) const;
+
+            /*!
+             * Reads the value stored in the given record buffer.
+             */
+            ValueType getRecordValue(std::vector<uint64_t> const& buffer, uint64_t record = 0) const;
+
+            // The number of 64-bit words per key.
+            uint64_t wordsPerEntry;
+
+            // The number of 64-bit words per record, i.e. the hash value, the key and the value.
+            uint64_t wordsPerRecord;
+
+            // The directory in which the segment files are created.
+            std::string directory;
+
+            // The number of bits by which a hash value is shifted to obtain its partition.
+            uint64_t partitionShift;
+
+            // The number of partitions per segment.
+            uint64_t numberOfPartitions;
+
+            // The number of bits of the Bloom filters per stored key.
+            uint64_t bloomFilterBitsPerEntry;
+
+            // The number of probes per key in the Bloom filters.
+            uint64_t bloomFilterProbes;
+
+            // The segments, ordered by the time at which they were spilled.
+            std::vector<std::unique_ptr<Segment>> segments;
+
+            // The total number of entries.
+            uint64_t numberOfEntries;
+
+            // A buffer for records read during lookups.
+            mutable std::vector<uint64_t> recordBuffer;
+        };
+
+    }
+}
@@ -8,6 +8,7 @@
 
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/DdMemoryBudgetExceededException.h"
 
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -485,6 +486,40 @@ namespace storm {
             internalDdManager.debugCheck();
         }
         
+        template<DdType LibraryType>
+        uint64_t DdManager<LibraryType>::getNumberOfNodes() const {
+            return internalDdManager.getNumberOfNodes();
+        }
+        
+        template<DdType LibraryType>
+        double DdManager<LibraryType>::getCacheHitRate() const {
+            return internalDdManager.getCacheHitRate();
+        }
+        
+        template<DdType LibraryType>
+        uint64_t DdManager<LibraryType>::getMemoryInUse() const {
+            return internalDdManager.getMemoryInUse();
+        }
+        
+        template<DdType LibraryType>
+        void DdManager<LibraryType>::performGarbageCollection() {
+            internalDdManager.performGarbageCollection();
+        }
+        
+        template<DdType LibraryType>
+        bool DdManager<LibraryType>::isMemoryBudgetExceeded() const {
+            return internalDdManager.isMemoryBudgetExceeded();
+        }
+        
+        template<DdType LibraryType>
+        void DdManager<LibraryType>::checkMemoryBudget() {
+            if (internalDdManager.isMemoryBudgetExceeded()) {
+                STORM_LOG_DEBUG("Memory budget of DD manager exceeded (" << this->getNumberOfNodes() << " nodes, " << this->getMemoryInUse() << " bytes), performing garbage collection.");
+                internalDdManager.performGarbageCollection();
+                STORM_LOG_THROW(!internalDdManager.isMemoryBudgetExceeded(), storm::exceptions::DdMemoryBudgetExceededException, "The memory budget of the DD library is exceeded (" << this->getNumberOfNodes() << " nodes, " << this->getMemoryInUse() << " bytes, cache hit rate " << this->getCacheHitRate() << ").");
+            }
+        }
+        
         template class DdManager<DdType::CUDD>;
         
         template Add<DdType::CUDD, double> DdManager<DdType::CUDD>::getAddZero() const;
@@ -321,6 +321,46 @@ namespace storm {
              * Performs a debug check if available.
              */
             void debugCheck() const;
+            
+            /*!
+             * Retrieves the number of nodes currently stored in the unique table of the manager.
+             *
+             * @return The number of nodes.
+             */
+            uint64_t getNumberOfNodes() const;
+            
+            /*!
+             * Retrieves the fraction of lookups in the computed table that resulted in a hit.
+             *
+             * @return The cache hit rate.
+             */
+            double getCacheHitRate() const;
+            
+            /*!
+             * Retrieves the (approximate) amount of memory in bytes that is currently occupied by the manager.
+             *
+             * @return The memory in use.
+             */
+            uint64_t getMemoryInUse() const;
+            
+            /*!
+             * Triggers a garbage collection of the nodes that are no longer referenced.
+             */
+            void performGarbageCollection();
+            
+            /*!
+             * Retrieves whether the manager exceeds the memory budget configured in the settings of the DD library.
+             *
+             * @return True iff the memory budget is exceeded.
+             */
+            bool isMemoryBudgetExceeded() const;
+            
+            /*!
+             * Checks whether the memory budget is exceeded and, if so, tries to free memory by garbage collection. If
+             * the budget is still exceeded afterwards, a DdMemoryBudgetExceededException is thrown. This is intended
+             * to be called at points of the computation from which callers can gracefully recover.
+             */
+            void checkMemoryBudget();
 
         private:
             /*!
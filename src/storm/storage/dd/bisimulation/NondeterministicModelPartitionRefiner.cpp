@@ -27,7 +27,11 @@ namespace storm {
                 // For this, we use the signature computer/refiner of this class.
                 
                 STORM_LOG_TRACE("Refining choice partition.");
-                Partition<DdType, ValueType> newChoicePartition = this->internalRefine(this->signatureComputer, this->signatureRefiner, this->choicePartition, this->statePartition, mode);
+                boost::optional<storm::dd::Bdd<DdType>> dirtyChoices;
+                if (this->restrictToDirtyBlocks && this->changedStates) {
+                    dirtyChoices = this->computeDirtyRows(this->choicePartition, false);
+                }
+                Partition<DdType, ValueType> newChoicePartition = this->internalRefine(this->signatureComputer, this->signatureRefiner, this->choicePartition, this->statePartition, mode, dirtyChoices);
                 
                 // If the choice partition has become stable in an iteration that is not the starting one, we have
                 // reached a fixed point and can return.
@@ -65,6 +69,7 @@ namespace storm {
                         this->status = Status::FixedPoint;
                         return false;
                     } else {
+                        this->updateChangedStates(this->statePartition, newStatePartition);
                         this->statePartition = newStatePartition;
                         return true;
                     }
@@ -83,6 +88,8 @@ namespace storm {
                 if (newStatePartition == this->statePartition) {
                     return false;
                 } else {
+                    // Refining wrt. rewards may touch arbitrary blocks, so the next refinement has to consider all of them.
+                    this->changedStates = boost::none;
                     this->statePartition = newStatePartition;
                     return true;
                 }
@@ -95,6 +102,7 @@ namespace storm {
                 if (newChoicePartition == this->choicePartition) {
                     return false;
                 } else {
+                    this->changedStates = boost::none;
                     this->choicePartition = newChoicePartition;
                     return true;
                 }
@@ -4,6 +4,9 @@
 
 #include "storm/storage/dd/DdManager.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -12,24 +15,85 @@ namespace storm {
         namespace bisimulation {
             
             template <storm::dd::DdType DdType, typename ValueType>
-            PartitionRefiner<DdType, ValueType>::PartitionRefiner(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& initialStatePartition) : status(Status::Initialized), refinements(0), statePartition(initialStatePartition), signatureComputer(model), signatureRefiner(model.getManager(), statePartition.getBlockVariable(), model.getRowAndNondeterminismVariables(), model.getColumnVariables(), !model.isNondeterministicModel(), model.getNondeterminismVariables()), totalSignatureTime(0), totalRefinementTime(0) {
-                // Intentionally left empty.
+            PartitionRefiner<DdType, ValueType>::PartitionRefiner(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& initialStatePartition) : status(Status::Initialized), refinements(0), statePartition(initialStatePartition), signatureComputer(model), signatureRefiner(model.getManager(), statePartition.getBlockVariable(), model.getRowAndNondeterminismVariables(), model.getColumnVariables(), !model.isNondeterministicModel(), model.getNondeterminismVariables()), restrictToDirtyBlocks(false), refinedWithAllSignatures(true), rowAndNondeterminismVariables(model.getRowAndNondeterminismVariables()), columnVariables(model.getColumnVariables()), rowColumnMetaVariablePairs(model.getRowColumnMetaVariablePairs()), totalSignatureTime(0), totalRefinementTime(0) {
+                if (storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getRefinementMode() == storm::settings::modules::BisimulationSettings::RefinementMode::DirtyBlocks) {
+                    this->setRestrictToDirtyBlocks(model, true);
+                }
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void PartitionRefiner<DdType, ValueType>::setRestrictToDirtyBlocks(storm::models::symbolic::Model<DdType, ValueType> const& model, bool value) {
+                // Restricting the refinement to dirty blocks relies on the refiner keeping the block numbers of rows
+                // whose signature is zero, i.e. of all rows outside of dirty blocks.
+                if (value && storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getReuseMode() != storm::settings::modules::BisimulationSettings::ReuseMode::BlockNumbers) {
+                    STORM_LOG_WARN("Refinement restricted to dirty blocks requires reusing block numbers. Falling back to full refinement.");
+                    value = false;
+                }
+                
+                restrictToDirtyBlocks = value;
+                changedStates = boost::none;
+                if (restrictToDirtyBlocks) {
+                    // The nondeterminism is kept, because nondeterministic models refine the partition of choices.
+                    qualitativeTransitionMatrix = model.getQualitativeTransitionMatrix(true);
+                } else {
+                    qualitativeTransitionMatrix = boost::none;
+                }
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
             bool PartitionRefiner<DdType, ValueType>::refine(SignatureMode const& mode) {
-                Partition<DdType, ValueType> newStatePartition = this->internalRefine(signatureComputer, signatureRefiner, statePartition, statePartition, mode);
+                boost::optional<storm::dd::Bdd<DdType>> dirtyStates;
+                if (restrictToDirtyBlocks && changedStates) {
+                    dirtyStates = computeDirtyRows(statePartition, true);
+                }
+                
+                Partition<DdType, ValueType> newStatePartition = this->internalRefine(signatureComputer, signatureRefiner, statePartition, statePartition, mode, dirtyStates);
                 if (statePartition.getNumberOfBlocks() == newStatePartition.getNumberOfBlocks()) {
                     this->status = Status::FixedPoint;
                     return false;
                 } else {
+                    updateChangedStates(statePartition, newStatePartition);
                     this->statePartition = newStatePartition;
                     return true;
                 }
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
-            Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine(SignatureComputer<DdType, ValueType>& signatureComputer, SignatureRefiner<DdType, ValueType>& signatureRefiner, Partition<DdType, ValueType> const& oldPartition, Partition<DdType, ValueType> const& targetPartition, SignatureMode const& mode) {
+            void PartitionRefiner<DdType, ValueType>::updateChangedStates(Partition<DdType, ValueType> const& oldStatePartition, Partition<DdType, ValueType> const& newStatePartition) {
+                if (restrictToDirtyBlocks && refinedWithAllSignatures) {
+                    // Since block numbers are reused, the states that changed their block are exactly the ones whose
+                    // (state, block) pair is not part of the old partition anymore.
+                    storm::dd::Bdd<DdType> oldPartitionBdd = oldStatePartition.storedAsBdd() ? oldStatePartition.asBdd() : oldStatePartition.asAdd().notZero();
+                    storm::dd::Bdd<DdType> newPartitionBdd = newStatePartition.storedAsBdd() ? newStatePartition.asBdd() : newStatePartition.asAdd().notZero();
+                    changedStates = (newPartitionBdd && !oldPartitionBdd).existsAbstract({newStatePartition.getBlockVariable()});
+                } else {
+                    changedStates = boost::none;
+                }
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Bdd<DdType> PartitionRefiner<DdType, ValueType>::computeDirtyRows(Partition<DdType, ValueType> const& partition, bool partitionOverColumnVariables) const {
+                STORM_LOG_ASSERT(changedStates, "Expected changed states.");
+                storm::dd::Bdd<DdType> partitionBdd = partition.storedAsBdd() ? partition.asBdd() : partition.asAdd().notZero();
+                
+                // Find all rows leading to the changed states and the blocks that contain them.
+                storm::dd::Bdd<DdType> predecessors = qualitativeTransitionMatrix.get().andExists(changedStates.get(), columnVariables);
+                if (partitionOverColumnVariables) {
+                    predecessors = predecessors.swapVariables(rowColumnMetaVariablePairs);
+                }
+                storm::dd::Bdd<DdType> dirtyBlocks = partitionBdd.andExists(predecessors, partitionOverColumnVariables ? columnVariables : rowAndNondeterminismVariables);
+                
+                // The signatures are computed over the row variables, so we need to shift a partition of states.
+                storm::dd::Bdd<DdType> dirtyRows = partitionBdd.andExists(dirtyBlocks, {partition.getBlockVariable()});
+                if (partitionOverColumnVariables) {
+                    dirtyRows = dirtyRows.swapVariables(rowColumnMetaVariablePairs);
+                }
+                STORM_LOG_TRACE("Restricting refinement to " << dirtyBlocks.getNonZeroCount() << " dirty blocks.");
+                return dirtyRows;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine(SignatureComputer<DdType, ValueType>& signatureComputer, SignatureRefiner<DdType, ValueType>& signatureRefiner, Partition<DdType, ValueType> const& oldPartition, Partition<DdType, ValueType> const& targetPartition, SignatureMode const& mode, boost::optional<storm::dd::Bdd<DdType>> const& dirtyRows) {
                 auto start = std::chrono::high_resolution_clock::now();
                 
                 if (this->status != Status::FixedPoint) {
@@ -43,7 +107,8 @@ namespace storm {
                     bool refined = false;
                     uint64_t index = 0;
                     Partition<DdType, ValueType> newPartition;
-                    auto signatureIterator = signatureComputer.compute(targetPartition);
+                    // Rows outside of dirty blocks get the zero signature and therefore keep their block.
+                    auto signatureIterator = signatureComputer.compute(targetPartition, dirtyRows);
                     while (signatureIterator.hasNext() && !refined) {
                         auto signatureStart = std::chrono::high_resolution_clock::now();
                         auto signature = signatureIterator.next();
@@ -65,6 +130,10 @@ namespace storm {
                         }
                     }
                     
+                    // With lazy signatures, the step may have been decided by the qualitative signature, so the
+                    // quantitative split of the blocks wrt. the old partition is still pending.
+                    refinedWithAllSignatures = !signatureIterator.hasNext();
+                    
                     auto totalTimeInRefinement = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
                     STORM_LOG_INFO("Refinement " << refinements << " produced " << newPartition.getNumberOfBlocks() << " blocks and was completed in " << totalTimeInRefinement << "ms (signature: " << signatureTime << "ms, refinement: " << refinementTime << "ms).");
                     ++refinements;
@@ -108,6 +177,8 @@ namespace storm {
                 if (newPartition == statePartition) {
                     return false;
                 } else {
+                    // Refining wrt. rewards may touch arbitrary blocks, so the next refinement has to consider all of them.
+                    changedStates = boost::none;
                     this->statePartition = newPartition;
                     return true;
                 }
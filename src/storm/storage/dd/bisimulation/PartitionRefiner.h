@@ -6,6 +6,8 @@
 #include "storm/storage/dd/bisimulation/SignatureComputer.h"
 #include "storm/storage/dd/bisimulation/SignatureRefiner.h"
 
+#include <boost/optional.hpp>
+
 namespace storm {
     namespace models {
         namespace symbolic {
@@ -53,16 +55,44 @@ namespace storm {
                  */
                 Status getStatus() const;
                 
+                /*!
+                 * Sets whether the signatures are only computed for the blocks that may have become unstable in the
+                 * last refinement step. By default, this is taken from the bisimulation settings.
+                 *
+                 * @param model The model whose partition is refined.
+                 * @param value If true, the refinement is restricted to dirty blocks.
+                 */
+                void setRestrictToDirtyBlocks(storm::models::symbolic::Model<DdType, ValueType> const& model, bool value);
+                
                 std::chrono::high_resolution_clock::duration getTotalSignatureTime() const;
                 std::chrono::high_resolution_clock::duration getTotalRefinementTime() const;
                 
             protected:
-                Partition<DdType, ValueType> internalRefine(SignatureComputer<DdType, ValueType>& stateSignatureComputer, SignatureRefiner<DdType, ValueType>& signatureRefiner, Partition<DdType, ValueType> const& oldPartition, Partition<DdType, ValueType> const& targetPartition, SignatureMode const& mode = SignatureMode::Eager);
+                Partition<DdType, ValueType> internalRefine(SignatureComputer<DdType, ValueType>& stateSignatureComputer, SignatureRefiner<DdType, ValueType>& signatureRefiner, Partition<DdType, ValueType> const& oldPartition, Partition<DdType, ValueType> const& targetPartition, SignatureMode const& mode = SignatureMode::Eager, boost::optional<storm::dd::Bdd<DdType>> const& dirtyRows = boost::none);
                 Partition<DdType, ValueType> internalRefine(Signature<DdType, ValueType> const& signature, SignatureRefiner<DdType, ValueType>& signatureRefiner, Partition<DdType, ValueType> const& oldPartition);
 
                 virtual bool refineWrtStateRewards(storm::dd::Add<DdType, ValueType> const& stateRewards);
                 virtual bool refineWrtStateActionRewards(storm::dd::Add<DdType, ValueType> const& stateActionRewards);
                 
+                /*!
+                 * Computes the rows (i.e. states or choices encoded over the row variables) of all blocks of the given
+                 * partition that contain a row leading to a state that changed its block in the last refinement step.
+                 * All other blocks are guaranteed to be stable.
+                 *
+                 * @param partition The partition whose dirty blocks to compute.
+                 * @param partitionOverColumnVariables A flag indicating whether the partition is a partition of states
+                 * encoded over the column variables (rather than a partition of choices over the row variables).
+                 */
+                storm::dd::Bdd<DdType> computeDirtyRows(Partition<DdType, ValueType> const& partition, bool partitionOverColumnVariables) const;
+                
+                /*!
+                 * If the refinement is restricted to dirty blocks, stores the states whose block changed between the
+                 * given state partitions. If the last refinement step was not decided by the final (full) signature,
+                 * blocks may still need to be split wrt. the old partition, so the changed states are reset and the
+                 * next step refines all blocks.
+                 */
+                void updateChangedStates(Partition<DdType, ValueType> const& oldStatePartition, Partition<DdType, ValueType> const& newStatePartition);
+                
                 // The current status.
                 Status status;
                 
@@ -78,6 +108,23 @@ namespace storm {
                 // The object used to refine the state partition based on the signatures.
                 SignatureRefiner<DdType, ValueType> signatureRefiner;
                 
+                // A flag indicating whether only blocks that may have become unstable are refined.
+                bool restrictToDirtyBlocks;
+                
+                // A flag indicating whether the last refinement step computed all signatures of the signature mode.
+                bool refinedWithAllSignatures;
+                
+                // If set, the states whose block changed in the last refinement step (encoded over column variables).
+                boost::optional<storm::dd::Bdd<DdType>> changedStates;
+                
+                // The qualitative transition relation including the nondeterminism (only set when restricting to dirty blocks).
+                boost::optional<storm::dd::Bdd<DdType>> qualitativeTransitionMatrix;
+                
+                // The variables of the model that are needed to compute the dirty blocks.
+                std::set<storm::expressions::Variable> rowAndNondeterminismVariables;
+                std::set<storm::expressions::Variable> columnVariables;
+                std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
+                
                 // Time measurements.
                 std::chrono::high_resolution_clock::duration totalSignatureTime;
                 std::chrono::high_resolution_clock::duration totalRefinementTime;
@@ -13,7 +13,7 @@ namespace storm {
         namespace bisimulation {
 
             template<storm::dd::DdType DdType, typename ValueType>
-            SignatureIterator<DdType, ValueType>::SignatureIterator(SignatureComputer<DdType, ValueType> const& signatureComputer, Partition<DdType, ValueType> const& partition) : signatureComputer(signatureComputer), partition(partition), position(0) {
+            SignatureIterator<DdType, ValueType>::SignatureIterator(SignatureComputer<DdType, ValueType> const& signatureComputer, Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction) : signatureComputer(signatureComputer), partition(partition), rowRestriction(rowRestriction), position(0) {
                 // Intentionally left empty.
             }
             
@@ -35,17 +35,17 @@ namespace storm {
                 
                 if (mode == SignatureMode::Eager) {
                     if (position == 0) {
-                        result = signatureComputer.getFullSignature(partition);
+                        result = signatureComputer.getFullSignature(partition, rowRestriction);
                     }
                 } else if (mode == SignatureMode::Lazy) {
                     if (position == 0) {
-                        result = signatureComputer.getQualitativeSignature(partition);
+                        result = signatureComputer.getQualitativeSignature(partition, rowRestriction);
                     } else {
-                        result = signatureComputer.getFullSignature(partition);
+                        result = signatureComputer.getFullSignature(partition, rowRestriction);
                     }
                 } else if (mode == SignatureMode::Qualitative) {
                     if (position == 0) {
-                        result = signatureComputer.getQualitativeSignature(partition);
+                        result = signatureComputer.getQualitativeSignature(partition, rowRestriction);
                     }
                 } else {
                     STORM_LOG_ASSERT(false, "Unknown signature mode.");
@@ -86,8 +86,8 @@ namespace storm {
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
-            SignatureIterator<DdType, ValueType> SignatureComputer<DdType, ValueType>::compute(Partition<DdType, ValueType> const& partition) {
-                return SignatureIterator<DdType, ValueType>(*this, partition);
+            SignatureIterator<DdType, ValueType> SignatureComputer<DdType, ValueType>::compute(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction) {
+                return SignatureIterator<DdType, ValueType>(*this, partition, rowRestriction);
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
@@ -101,24 +101,26 @@ namespace storm {
             }
                         
             template<storm::dd::DdType DdType, typename ValueType>
-            Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getFullSignature(Partition<DdType, ValueType> const& partition) const {
+            Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getFullSignature(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction) const {
+                // Restricting the matrix first confines the (expensive) multiplication to the relevant rows.
+                storm::dd::Add<DdType, ValueType> restrictedTransitionMatrix = restrictRows(this->transitionMatrix, rowRestriction);
                 if (partition.storedAsBdd()) {
                     if (partition.hasChangedStates()) {
-                        return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asBdd() && partition.changedStatesAsBdd(), columnVariables));
+                        return Signature<DdType, ValueType>(restrictedTransitionMatrix.multiplyMatrix(partition.asBdd() && partition.changedStatesAsBdd(), columnVariables));
                     } else {
-                        return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asBdd(), columnVariables));
+                        return Signature<DdType, ValueType>(restrictedTransitionMatrix.multiplyMatrix(partition.asBdd(), columnVariables));
                     }
                 } else {
                     if (partition.hasChangedStates()) {
-                        return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asAdd() * partition.changedStatesAsAdd(), columnVariables));
+                        return Signature<DdType, ValueType>(restrictedTransitionMatrix.multiplyMatrix(partition.asAdd() * partition.changedStatesAsAdd(), columnVariables));
                     } else {
-                        return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asAdd(), columnVariables));
+                        return Signature<DdType, ValueType>(restrictedTransitionMatrix.multiplyMatrix(partition.asAdd(), columnVariables));
                     }
                 }
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
-            Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getQualitativeSignature(Partition<DdType, ValueType> const& partition) const {
+            Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getQualitativeSignature(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction) const {
                 if (!transitionMatrix01) {
                     if (DdType == storm::dd::DdType::Sylvan || this->ensureQualitative) {
                         this->transitionMatrix01 = this->transitionMatrix.notZero();
@@ -128,16 +130,32 @@ namespace storm {
                 }
 
                 if (partition.storedAsBdd()) {
-                    return this->getQualitativeTransitionMatrixAsBdd().andExists(partition.asBdd(), columnVariables).template toAdd<ValueType>();
+                    return restrictRows(this->getQualitativeTransitionMatrixAsBdd(), rowRestriction).andExists(partition.asBdd(), columnVariables).template toAdd<ValueType>();
                 } else {
                     if (this->qualitativeTransitionMatrixIsBdd()) {
-                        return Signature<DdType, ValueType>(this->getQualitativeTransitionMatrixAsBdd().andExists(partition.asAdd().toBdd(), columnVariables).template toAdd<ValueType>());
+                        return Signature<DdType, ValueType>(restrictRows(this->getQualitativeTransitionMatrixAsBdd(), rowRestriction).andExists(partition.asAdd().toBdd(), columnVariables).template toAdd<ValueType>());
                     } else {
-                        return Signature<DdType, ValueType>(this->getQualitativeTransitionMatrixAsAdd().multiplyMatrix(partition.asAdd(), columnVariables));
+                        return Signature<DdType, ValueType>(restrictRows(this->getQualitativeTransitionMatrixAsAdd(), rowRestriction).multiplyMatrix(partition.asAdd(), columnVariables));
                     }
                 }
             }
 
+            template<storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Add<DdType, ValueType> SignatureComputer<DdType, ValueType>::restrictRows(storm::dd::Add<DdType, ValueType> const& matrix, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction) {
+                if (rowRestriction) {
+                    return rowRestriction.get().ite(matrix, matrix.getDdManager().template getAddZero<ValueType>());
+                }
+                return matrix;
+            }
+            
+            template<storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Bdd<DdType> SignatureComputer<DdType, ValueType>::restrictRows(storm::dd::Bdd<DdType> const& matrix, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction) {
+                if (rowRestriction) {
+                    return matrix && rowRestriction.get();
+                }
+                return matrix;
+            }
+            
             template<storm::dd::DdType DdType, typename ValueType>
             bool SignatureComputer<DdType, ValueType>::qualitativeTransitionMatrixIsBdd() const {
                 return transitionMatrix01.get().which() == 0;
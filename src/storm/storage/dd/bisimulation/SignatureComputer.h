@@ -20,7 +20,7 @@ namespace storm {
             template<storm::dd::DdType DdType, typename ValueType>
             class SignatureIterator {
             public:
-                SignatureIterator(SignatureComputer<DdType, ValueType> const& signatureComputer, Partition<DdType, ValueType> const& partition);
+                SignatureIterator(SignatureComputer<DdType, ValueType> const& signatureComputer, Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction = boost::none);
 
                 bool hasNext() const;
                 
@@ -33,6 +33,9 @@ namespace storm {
                 // The current partition.
                 Partition<DdType, ValueType> const& partition;
                 
+                // If set, the rows of the transition matrix to which the signatures are restricted.
+                boost::optional<storm::dd::Bdd<DdType>> rowRestriction;
+                
                 // The position in the enumeration.
                 uint64_t position;
             };
@@ -49,13 +52,21 @@ namespace storm {
 
                 void setSignatureMode(SignatureMode const& newMode);
 
-                SignatureIterator<DdType, ValueType> compute(Partition<DdType, ValueType> const& partition);
+                /*!
+                 * Computes the signatures wrt. the given partition. If a row restriction is given, only the rows of the
+                 * transition matrix in the restriction are considered, i.e. all other rows get the zero signature.
+                 */
+                SignatureIterator<DdType, ValueType> compute(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction = boost::none);
 
                 /// Methods to compute the signatures.
-                Signature<DdType, ValueType> getFullSignature(Partition<DdType, ValueType> const& partition) const;
-                Signature<DdType, ValueType> getQualitativeSignature(Partition<DdType, ValueType> const& partition) const;
+                Signature<DdType, ValueType> getFullSignature(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction = boost::none) const;
+                Signature<DdType, ValueType> getQualitativeSignature(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction = boost::none) const;
 
             private:
+                /// Methods to restrict a matrix to the given rows (if any).
+                static storm::dd::Add<DdType, ValueType> restrictRows(storm::dd::Add<DdType, ValueType> const& matrix, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction);
+                static storm::dd::Bdd<DdType> restrictRows(storm::dd::Bdd<DdType> const& matrix, boost::optional<storm::dd::Bdd<DdType>> const& rowRestriction);
+                
                 bool qualitativeTransitionMatrixIsBdd() const;
                 storm::dd::Bdd<DdType> const& getQualitativeTransitionMatrixAsBdd() const;
                 storm::dd::Add<DdType, ValueType> const& getQualitativeTransitionMatrixAsAdd() const;
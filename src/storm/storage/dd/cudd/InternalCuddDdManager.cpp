@@ -3,15 +3,44 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CuddSettings.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/DdMemoryBudgetExceededException.h"
 
 namespace storm {
     namespace dd {
         
-        InternalDdManager<DdType::CUDD>::InternalDdManager() : cuddManager(), reorderingTechnique(CUDD_REORDER_NONE), numberOfDdVariables(0) {
-            this->cuddManager.SetMaxMemory(static_cast<unsigned long>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getMaximalMemory() * 1024ul * 1024ul));
-            
+        // The (approximate) sizes of a node in the unique table and an entry of the computed table on 64-bit platforms.
+        static const uint64_t CUDD_NODE_SIZE = 32;
+        static const uint64_t CUDD_CACHE_ENTRY_SIZE = 32;
+        
+        static void cuddErrorHandler(std::string message) {
+            // Report running out of memory by means of an exception that callers may recover from.
+            if (message.compare(0, 13, "Out of memory") == 0 || message == "Maximum memory exceeded." || message == "Too many nodes.") {
+                STORM_LOG_THROW(false, storm::exceptions::DdMemoryBudgetExceededException, "CUDD ran out of memory: " << message);
+            }
+            cudd::defaultError(message);
+        }
+        
+        InternalDdManager<DdType::CUDD>::InternalDdManager() : cuddManager(), reorderingTechnique(CUDD_REORDER_NONE), numberOfDdVariables(0), memoryBudget(0) {
             auto const& settings = storm::settings::getModule<storm::settings::modules::CuddSettings>();
+            uint64_t maximalMemory = settings.getMaximalMemory() * 1024ul * 1024ul;
+            this->cuddManager.SetMaxMemory(static_cast<unsigned long>(maximalMemory));
+            this->cuddManager.setHandler(&cuddErrorHandler);
+            
+            // If there is a memory budget, we restrict the growth of the unique and the computed table accordingly.
+            // This mirrors the sizing that CUDD performs upon initialization, which is otherwise based on the memory
+            // of the machine.
+            this->memoryBudget = static_cast<uint64_t>(maximalMemory * settings.getMemoryBudget());
+            if (this->memoryBudget > 0) {
+                uint64_t maxUnsigned = std::numeric_limits<unsigned int>::max();
+                this->cuddManager.SetLooseUpTo(static_cast<unsigned int>(std::min(maxUnsigned, this->memoryBudget / (CUDD_NODE_SIZE * 5))));
+                this->cuddManager.SetMaxCacheHard(static_cast<unsigned int>(std::min(maxUnsigned, this->memoryBudget / (CUDD_CACHE_ENTRY_SIZE * 3))));
+            }
+            
             this->cuddManager.SetEpsilon(settings.getConstantPrecision());
             
             // Now set the selected reordering technique.
@@ -157,6 +186,27 @@ namespace storm {
             this->getCuddManager().DebugCheck();
         }
         
+        uint64_t InternalDdManager<DdType::CUDD>::getNumberOfNodes() const {
+            return static_cast<uint64_t>(this->getCuddManager().ReadNodeCount());
+        }
+        
+        double InternalDdManager<DdType::CUDD>::getCacheHitRate() const {
+            double lookups = this->getCuddManager().ReadCacheLookUps();
+            return lookups > 0 ? this->getCuddManager().ReadCacheHits() / lookups : 0.0;
+        }
+        
+        uint64_t InternalDdManager<DdType::CUDD>::getMemoryInUse() const {
+            return static_cast<uint64_t>(this->getCuddManager().ReadMemoryInUse());
+        }
+        
+        void InternalDdManager<DdType::CUDD>::performGarbageCollection() {
+            cuddGarbageCollect(this->getCuddManager().getManager(), 1);
+        }
+        
+        bool InternalDdManager<DdType::CUDD>::isMemoryBudgetExceeded() const {
+            return memoryBudget > 0 && this->getMemoryInUse() > memoryBudget;
+        }
+        
         cudd::Cudd& InternalDdManager<DdType::CUDD>::getCuddManager() {
             return cuddManager;
         }
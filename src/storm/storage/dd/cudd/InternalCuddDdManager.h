@@ -131,6 +131,39 @@ namespace storm {
              */
             void debugCheck() const;
             
+            /*!
+             * Retrieves the number of nodes currently stored in the unique table.
+             *
+             * @return The number of nodes.
+             */
+            uint64_t getNumberOfNodes() const;
+            
+            /*!
+             * Retrieves the fraction of lookups in the computed table that resulted in a hit.
+             *
+             * @return The cache hit rate.
+             */
+            double getCacheHitRate() const;
+            
+            /*!
+             * Retrieves the (approximate) amount of memory in bytes that is currently occupied by the manager.
+             *
+             * @return The memory in use.
+             */
+            uint64_t getMemoryInUse() const;
+            
+            /*!
+             * Triggers a garbage collection of the nodes that are no longer referenced.
+             */
+            void performGarbageCollection();
+            
+            /*!
+             * Retrieves whether the manager exceeds the memory budget configured in the settings.
+             *
+             * @return True iff the memory budget is exceeded.
+             */
+            bool isMemoryBudgetExceeded() const;
+            
             /*!
              * Retrieves the number of DD variables managed by this manager.
              *
@@ -164,6 +197,10 @@ namespace storm {
             
             // Keeps track of the number of registered DD variables.
             uint_fast64_t numberOfDdVariables;
+            
+            // The amount of memory (in bytes) that CUDD may occupy before the budget is considered exceeded (0 means
+            // no budget).
+            uint64_t memoryBudget;
         };        
     }
 }
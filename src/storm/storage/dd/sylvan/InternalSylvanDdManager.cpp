@@ -45,6 +45,19 @@ namespace storm {
         // some operations.
         uint_fast64_t InternalDdManager<DdType::Sylvan>::nextFreeVariableIndex = 0;
         
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::cacheSize = 0;
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::memoryBudget = 0;
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::budgetChecksSinceLastScan = 0;
+        bool InternalDdManager<DdType::Sylvan>::memoryBudgetExceededAtLastScan = false;
+        
+        // The number of bytes occupied by an entry of the unique table (a 16 byte node plus its 8 byte hash bucket) and
+        // an entry of the operation cache (a 32 byte entry plus its 4 byte status), respectively.
+        static const uint64_t sylvanTableEntrySize = 24;
+        static const uint64_t sylvanCacheEntrySize = 36;
+        
+        // The number of budget checks between two scans of the unique table.
+        static const uint64_t budgetCheckScanInterval = 16;
+        
         uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
             for (uint_fast64_t index = 0; index < 64; ++index) {
                 if ((number & (1ull << (63 - index))) != 0) {
@@ -78,9 +91,9 @@ namespace storm {
                     max_c <<= -table_ratio;
                 }
                 
-                uint64_t cur = max_t * 24 + max_c * 36;
+                uint64_t cur = max_t * sylvanTableEntrySize + max_c * sylvanCacheEntrySize;
                 STORM_LOG_THROW(cur <= memorycap, storm::exceptions::InvalidSettingsException, "Memory cap incompatible with default table ratio.");
-                STORM_LOG_WARN_COND(memorycap < 60 * 0x0000040000000000, "Sylvan only supports tablesizes <= 42 bits. Memory limit is changed accordingly.");
+                STORM_LOG_WARN_COND(memorycap < (sylvanTableEntrySize + sylvanCacheEntrySize) * 0x0000040000000000, "Sylvan only supports tablesizes <= 42 bits. Memory limit is changed accordingly.");
 
                 while (2*cur < memorycap && max_t < 0x0000040000000000) {
                     max_t *= 2;
@@ -96,6 +109,9 @@ namespace storm {
                 }
                 // End of copied code.
                 
+                cacheSize = max_c;
+                memoryBudget = static_cast<uint_fast64_t>(max_t * settings.getMemoryBudget());
+                
                 STORM_LOG_DEBUG("Initializing sylvan library. Initial/max table size: " << min_t << "/" << max_t << ", initial/max cache size: " << min_c << "/" << max_c << ".");
                 sylvan::Sylvan::initPackage(min_t, max_t, min_c, max_c);
 
@@ -259,6 +275,52 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
         }
         
+        uint64_t InternalDdManager<DdType::Sylvan>::getNumberOfNodes() const {
+            LACE_ME;
+            size_t filled;
+            sylvan_table_usage(&filled, NULL);
+            return filled;
+        }
+        
+        double InternalDdManager<DdType::Sylvan>::getCacheHitRate() const {
+            // Note that the counters are only maintained if sylvan was built with statistics enabled.
+            LACE_ME;
+            sylvan_stats_t stats;
+            sylvan_stats_snapshot(&stats);
+            
+            uint64_t lookups = 0;
+            uint64_t hits = 0;
+            for (uint64_t counter = BDD_ITE; counter < SYLVAN_GC_COUNT; counter += 3) {
+                lookups += stats.counters[counter];
+                hits += stats.counters[counter + 2];
+            }
+            return lookups > 0 ? static_cast<double>(hits) / lookups : 0.0;
+        }
+        
+        uint64_t InternalDdManager<DdType::Sylvan>::getMemoryInUse() const {
+            LACE_ME;
+            size_t total;
+            sylvan_table_usage(NULL, &total);
+            return total * sylvanTableEntrySize + cacheSize * sylvanCacheEntrySize;
+        }
+        
+        void InternalDdManager<DdType::Sylvan>::performGarbageCollection() {
+            LACE_ME;
+            sylvan_gc();
+        }
+        
+        bool InternalDdManager<DdType::Sylvan>::isMemoryBudgetExceeded() const {
+            if (memoryBudget == 0) {
+                return false;
+            }
+            if (!memoryBudgetExceededAtLastScan && ++budgetChecksSinceLastScan < budgetCheckScanInterval) {
+                return false;
+            }
+            budgetChecksSinceLastScan = 0;
+            memoryBudgetExceededAtLastScan = this->getNumberOfNodes() > memoryBudget;
+            return memoryBudgetExceededAtLastScan;
+        }
+        
         uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfDdVariables() const {
             return nextFreeVariableIndex;
         }
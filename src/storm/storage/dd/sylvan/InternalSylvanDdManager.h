@@ -132,6 +132,40 @@ namespace storm {
              */
             void debugCheck() const;
             
+            /*!
+             * Retrieves the number of nodes currently stored in the unique table.
+             *
+             * @return The number of nodes.
+             */
+            uint64_t getNumberOfNodes() const;
+            
+            /*!
+             * Retrieves the fraction of lookups in the computed table that resulted in a hit.
+             *
+             * @return The cache hit rate.
+             */
+            double getCacheHitRate() const;
+            
+            /*!
+             * Retrieves the (approximate) amount of memory in bytes that is currently occupied by the manager.
+             *
+             * @return The memory in use.
+             */
+            uint64_t getMemoryInUse() const;
+            
+            /*!
+             * Triggers a garbage collection of the nodes that are no longer referenced.
+             */
+            void performGarbageCollection();
+            
+            /*!
+             * Retrieves whether the manager exceeds the memory budget configured in the settings. As this requires a scan
+             * of the unique table, the scan is only performed every few calls.
+             *
+             * @return True iff the memory budget is exceeded.
+             */
+            bool isMemoryBudgetExceeded() const;
+            
             /*!
              * Retrieves the number of DD variables managed by this manager.
              *
@@ -151,6 +185,18 @@ namespace storm {
             // The index of the next free variable index. This needs to be shared across all instances since the sylvan
             // manager is implicitly 'global'.
             static uint_fast64_t nextFreeVariableIndex;
+            
+            // The size of the operation cache. This needs to be shared across all instances since the sylvan manager
+            // is implicitly 'global'.
+            static uint_fast64_t cacheSize;
+            
+            // The number of nodes in the unique table that constitutes the memory budget (0 means no budget).
+            static uint_fast64_t memoryBudget;
+            
+            // Counting the nodes requires a scan of the unique table. Therefore, the budget is only checked every few
+            // calls, unless it was exceeded at the last check.
+            static uint_fast64_t budgetChecksSinceLastScan;
+            static bool memoryBudgetExceededAtLastScan;
         };
         
         template<>
@@ -1,17 +1,81 @@
 #include "storm/storage/sparse/StateStorage.h"
 
+#include "storm/utility/macros.h"
+
 namespace storm {
     namespace storage {
         namespace sparse {
                         
             template <typename StateType>
-            StateStorage<StateType>::StateStorage(uint64_t bitsPerState) : stateToId(bitsPerState, 100000), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
+            StateStorage<StateType>::StateStorage(uint64_t bitsPerState) : stateToId(bitsPerState, 100000), spilledStateToId(), maximalNumberOfStatesInMemory(0), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
                 // Intentionally left empty.
             }
 
             template <typename StateType>
             uint_fast64_t StateStorage<StateType>::getNumberOfStates() const {
-                return stateToId.size();
+                return stateToId.size() + (spilledStateToId ? spilledStateToId->size() : 0);
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::enableSpilling(std::string const& directory, uint64_t maximalNumberOfStatesInMemory) {
+                spilledStateToId = std::make_shared<storm::storage::SpilledBitVectorMap<StateType>>(bitsPerState, directory);
+                this->maximalNumberOfStatesInMemory = maximalNumberOfStatesInMemory;
+            }
+            
+            template <typename StateType>
+            bool StateStorage<StateType>::hasSpilledStates() const {
+                return spilledStateToId && spilledStateToId->size() > 0;
+            }
+            
+            template <typename StateType>
+            StateType StateStorage<StateType>::findOrAdd(storm::storage::BitVector const& state, StateType const& newIndex) {
+                if (!spilledStateToId) {
+                    return stateToId.findOrAdd(state, newIndex);
+                }
+                
+                // A state is either held in memory or spilled, so the (mostly filter-based) lookup of spilled states
+                // can precede the single lookup in the in-memory map.
+                boost::optional<StateType> spilledIndex = spilledStateToId->find(state);
+                if (spilledIndex) {
+                    return spilledIndex.get();
+                }
+                
+                StateType index = stateToId.findOrAdd(state, newIndex);
+                if (index == newIndex && stateToId.size() >= maximalNumberOfStatesInMemory) {
+                    STORM_LOG_DEBUG("Spilling " << stateToId.size() << " states to disk.");
+                    spilledStateToId->spill(stateToId);
+                    stateToId = storm::storage::BitVectorHashMap<StateType>(bitsPerState, 100000);
+                }
+                return index;
+            }
+            
+            template <typename StateType>
+            boost::optional<StateType> StateStorage<StateType>::getStateIndex(storm::storage::BitVector const& state) const {
+                if (stateToId.contains(state)) {
+                    return stateToId.getValue(state);
+                }
+                if (spilledStateToId) {
+                    return spilledStateToId->find(state);
+                }
+                return boost::none;
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::forEachState(std::function<void (storm::storage::BitVector const&, StateType const&)> const& callback) const {
+                for (auto const& stateIndexPair : stateToId) {
+                    callback(stateIndexPair.first, stateIndexPair.second);
+                }
+                if (spilledStateToId) {
+                    spilledStateToId->forEach(callback);
+                }
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::remap(std::function<StateType(StateType const&)> const& remapping) {
+                stateToId.remap(remapping);
+                if (spilledStateToId) {
+                    spilledStateToId->remap(remapping);
+                }
             }
             
             template struct StateStorage<uint32_t>;
@@ -1,8 +1,14 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <boost/optional.hpp>
 
 #include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SpilledBitVectorMap.h"
 
 namespace storm {
     namespace storage {
@@ -14,9 +20,16 @@ namespace storm {
                 // Creates an empty state storage structure for storing states of the given bit width.
                 StateStorage(uint64_t bitsPerState);
                 
-                // This member stores all the states and maps them to their unique indices.
+                // This member stores all the states and maps them to their unique indices. If spilling is enabled,
+                // it only holds the states that have not yet been spilled to disk.
                 storm::storage::BitVectorHashMap<StateType> stateToId;
                 
+                // The states that were spilled to disk (if spilling is enabled).
+                std::shared_ptr<storm::storage::SpilledBitVectorMap<StateType>> spilledStateToId;
+                
+                // The number of states that are kept in memory before they are spilled to disk.
+                uint64_t maximalNumberOfStatesInMemory;
+                
                 // A list of initial states in terms of their global indices.
                 std::vector<StateType> initialStateIndices;
                 
@@ -28,6 +41,26 @@ namespace storm {
                 
                 // Get the number of states that were found in the exploration so far.
                 uint64_t getNumberOfStates() const;
+                
+                // Enables spilling the states to files in the given directory whenever more than the given number of
+                // states are held in memory.
+                void enableSpilling(std::string const& directory, uint64_t maximalNumberOfStatesInMemory);
+                
+                // Retrieves whether states have been spilled to disk.
+                bool hasSpilledStates() const;
+                
+                // Searches for the given state. If it is not found, it is inserted with the given index. Returns the
+                // index of the state. This takes spilled states into account.
+                StateType findOrAdd(storm::storage::BitVector const& state, StateType const& newIndex);
+                
+                // Retrieves the index of the given state, if it has been found already.
+                boost::optional<StateType> getStateIndex(storm::storage::BitVector const& state) const;
+                
+                // Invokes the given callback for all states found so far, including spilled ones.
+                void forEachState(std::function<void (storm::storage::BitVector const&, StateType const&)> const& callback) const;
+                
+                // Applies the given remapping to the indices of all states found so far, including spilled ones.
+                void remap(std::function<StateType(StateType const&)> const& remapping);
             };
             
         }
@@ -1,5 +1,9 @@
 #include "storm/storage/sparse/StateValuations.h"
 
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
 #include "storm/storage/BitVector.h"
 
 #include "storm/utility/vector.h"
@@ -10,17 +14,176 @@ namespace storm {
     namespace storage {
         namespace sparse {
             
-            StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues) : booleanValues(std::move(booleanValues)), integerValues(std::move(integerValues)), rationalValues(std::move(rationalValues)) {
-                // Intentionally left empty
+            namespace {
+                // Maps integers to unsigned integers such that the order is preserved. This allows to compute
+                // differences of arbitrary values without overflows.
+                uint64_t toOrderedUnsigned(int64_t value) {
+                    return static_cast<uint64_t>(value) ^ (1ull << 63);
+                }
+
+                int64_t fromOrderedUnsigned(uint64_t value) {
+                    return static_cast<int64_t>(value ^ (1ull << 63));
+                }
+
+                uint64_t getMaximalOffset(uint64_t bitWidth) {
+                    return bitWidth == 64 ? std::numeric_limits<uint64_t>::max() : (1ull << bitWidth) - 1;
+                }
+
+                uint64_t getRequiredBitWidth(uint64_t range) {
+                    uint64_t result = 0;
+                    while (range > 0) {
+                        ++result;
+                        range >>= 1;
+                    }
+                    return result;
+                }
+
+                // Ensures that all values of a range that starts at the given (ordered unsigned) base are representable.
+                uint64_t clampBase(uint64_t base, uint64_t bitWidth) {
+                    return std::min(base, std::numeric_limits<uint64_t>::max() - getMaximalOffset(bitWidth));
+                }
             }
             
-            typename StateValuations::StateValuation const& StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
-                STORM_LOG_ASSERT(stateIndex < valuations.size(), "Invalid state index.");
-                STORM_LOG_ASSERT(assertValuation(valuations[stateIndex]), "Invalid  state valuations");
-                return valuations[stateIndex];
+            StateValuations::IntegerColumn::IntegerColumn(int64_t lowerBound, int64_t upperBound) : size(0) {
+                STORM_LOG_ASSERT(lowerBound <= upperBound, "Invalid bounds [" << lowerBound << ", " << upperBound << "].");
+                uint64_t base = toOrderedUnsigned(lowerBound);
+                bitWidth = getRequiredBitWidth(toOrderedUnsigned(upperBound) - base);
+                this->lowerBound = fromOrderedUnsigned(clampBase(base, bitWidth));
+            }
+
+            int64_t StateValuations::IntegerColumn::get(uint64_t index) const {
+                STORM_LOG_ASSERT(index < size, "Invalid index.");
+                if (bitWidth == 0) {
+                    return lowerBound;
+                }
+                return static_cast<int64_t>(static_cast<uint64_t>(lowerBound) + bits.getAsInt(index * bitWidth, bitWidth));
+            }
+
+            void StateValuations::IntegerColumn::set(uint64_t index, int64_t value) {
+                STORM_LOG_ASSERT(index < size, "Invalid index.");
+                uint64_t base = toOrderedUnsigned(lowerBound);
+                uint64_t orderedValue = toOrderedUnsigned(value);
+                if (orderedValue < base || orderedValue - base > getMaximalOffset(bitWidth)) {
+                    // Enlarge the range such that it contains the value. We reserve an additional bit so that extending
+                    // the range value by value does not require repacking each time.
+                    uint64_t newBase = std::min(base, orderedValue);
+                    uint64_t newTop = std::max(base + getMaximalOffset(bitWidth), orderedValue);
+                    uint64_t newBitWidth = std::min(static_cast<uint64_t>(64), getRequiredBitWidth(newTop - newBase) + 1);
+                    if (orderedValue < base) {
+                        // Put the slack below the range as we expect further values in this direction.
+                        newBase -= std::min(newBase, getMaximalOffset(newBitWidth) - (newTop - newBase));
+                    }
+                    repack(fromOrderedUnsigned(clampBase(newBase, newBitWidth)), newBitWidth, size);
+                }
+                if (bitWidth > 0) {
+                    bits.setFromInt(index * bitWidth, bitWidth, static_cast<uint64_t>(value) - static_cast<uint64_t>(lowerBound));
+                }
+            }
+
+            void StateValuations::IntegerColumn::grow(uint64_t newSize) {
+                bits.grow(newSize * bitWidth);
+                size = newSize;
+            }
+
+            void StateValuations::IntegerColumn::resize(uint64_t newSize) {
+                bits.resize(newSize * bitWidth);
+                size = newSize;
+            }
+
+            int64_t StateValuations::IntegerColumn::getLowerBound() const {
+                return lowerBound;
+            }
+
+            int64_t StateValuations::IntegerColumn::getUpperBound() const {
+                return fromOrderedUnsigned(toOrderedUnsigned(lowerBound) + getMaximalOffset(bitWidth));
+            }
+
+            uint64_t StateValuations::IntegerColumn::getBitWidth() const {
+                return bitWidth;
+            }
+
+            void StateValuations::IntegerColumn::repack(int64_t newLowerBound, uint64_t newBitWidth, uint64_t newCapacity) {
+                STORM_LOG_TRACE("Repacking integer values to range [" << newLowerBound << ", " << fromOrderedUnsigned(toOrderedUnsigned(newLowerBound) + getMaximalOffset(newBitWidth)) << "].");
+                storm::storage::BitVector newBits(newCapacity * newBitWidth);
+                if (newBitWidth > 0) {
+                    for (uint64_t index = 0; index < size; ++index) {
+                        newBits.setFromInt(index * newBitWidth, newBitWidth, static_cast<uint64_t>(get(index)) - static_cast<uint64_t>(newLowerBound));
+                    }
+                }
+                bits = std::move(newBits);
+                lowerBound = newLowerBound;
+                bitWidth = newBitWidth;
+            }
+
+            StateValuations::StateValuations() : numberOfStates(0) {
+                // Intentionally left empty.
+            }
+
+            StateValuations::StateValuations(StateValuations const& other, std::vector<storm::storage::sparse::state_type> const& selectedStates) : variableToIndexMap(other.variableToIndexMap), numberOfStates(0), booleanValues(other.booleanValues.size()), rationalValues(other.rationalValues.size()) {
+                integerValues.reserve(other.integerValues.size());
+                for (auto const& column : other.integerValues) {
+                    integerValues.emplace_back(column.getLowerBound(), column.getUpperBound());
+                }
+                resizeColumns(selectedStates.size(), true);
+
+                for (uint64_t newState = 0; newState < selectedStates.size(); ++newState) {
+                    if (selectedStates[newState] < other.numberOfStates && other.nonEmptyStates.get(selectedStates[newState])) {
+                        nonEmptyStates.set(newState);
+                    }
+                }
+
+                // Copy the values column by column.
+                for (uint64_t column = 0; column < booleanValues.size(); ++column) {
+                    for (auto const& newState : nonEmptyStates) {
+                        booleanValues[column].set(newState, other.booleanValues[column].get(selectedStates[newState]));
+                    }
+                }
+                for (uint64_t column = 0; column < integerValues.size(); ++column) {
+                    for (auto const& newState : nonEmptyStates) {
+                        integerValues[column].set(newState, other.integerValues[column].get(selectedStates[newState]));
+                    }
+                }
+                for (uint64_t column = 0; column < rationalValues.size(); ++column) {
+                    for (auto const& newState : nonEmptyStates) {
+                        rationalValues[column][newState] = other.rationalValues[column][selectedStates[newState]];
+                    }
+                }
             }
 
-            StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt, StateValuation const* valuation) : variableIt(variableIt), valuation(valuation) {
+            void StateValuations::assertValuation(storm::storage::sparse::state_type const& stateIndex) const {
+                STORM_LOG_ASSERT(stateIndex < numberOfStates, "Invalid state index.");
+                STORM_LOG_ASSERT(nonEmptyStates.get(stateIndex), "Valuation does not provide a value for all variables.");
+            }
+
+            void StateValuations::resizeColumns(uint64_t newNumberOfStates, bool exact) {
+                numberOfStates = newNumberOfStates;
+                if (exact) {
+                    nonEmptyStates.resize(numberOfStates);
+                    for (auto& column : booleanValues) {
+                        column.resize(numberOfStates);
+                    }
+                    for (auto& column : integerValues) {
+                        column.resize(numberOfStates);
+                    }
+                    for (auto& column : rationalValues) {
+                        column.resize(numberOfStates);
+                        column.shrink_to_fit();
+                    }
+                } else {
+                    nonEmptyStates.grow(numberOfStates);
+                    for (auto& column : booleanValues) {
+                        column.grow(numberOfStates);
+                    }
+                    for (auto& column : integerValues) {
+                        column.grow(numberOfStates);
+                    }
+                    for (auto& column : rationalValues) {
+                        column.resize(numberOfStates);
+                    }
+                }
+            }
+
+            StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt, StateValuations const* valuations, storm::storage::sparse::state_type const& state) : variableIt(variableIt), valuations(valuations), state(state) {
                 // Intentionally left empty.
             }
 
@@ -31,25 +194,25 @@ namespace storm {
             
             bool StateValuations::StateValueIterator::getBooleanValue() const {
                 STORM_LOG_ASSERT(isBoolean(), "Variable has no boolean type.");
-                return valuation->booleanValues[variableIt->second];
+                return valuations->booleanValues[variableIt->second].get(state);
             }
             
             int64_t StateValuations::StateValueIterator::getIntegerValue() const {
                 STORM_LOG_ASSERT(isInteger(), "Variable has no integer type.");
-                return valuation->integerValues[variableIt->second];
+                return valuations->integerValues[variableIt->second].get(state);
             }
             
             storm::RationalNumber StateValuations::StateValueIterator::getRationalValue() const {
                 STORM_LOG_ASSERT(isRational(), "Variable has no rational type.");
-                return valuation->rationalValues[variableIt->second];
+                return valuations->rationalValues[variableIt->second][state];
             }
             
             bool StateValuations::StateValueIterator::operator==(StateValueIterator const& other) {
-                STORM_LOG_ASSERT(valuation == valuation, "Comparing iterators for different states");
+                STORM_LOG_ASSERT(valuations == other.valuations && state == other.state, "Comparing iterators for different states");
                 return variableIt == other.variableIt;
             }
             bool StateValuations::StateValueIterator::operator!=(StateValueIterator const& other) {
-                STORM_LOG_ASSERT(valuation == valuation, "Comparing iterators for different states");
+                STORM_LOG_ASSERT(valuations == other.valuations && state == other.state, "Comparing iterators for different states");
                 return variableIt != other.variableIt;
             }
             
@@ -63,76 +226,87 @@ namespace storm {
                 return *this;
             }
             
-            StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, StateValuation const* valuation) : variableMap(variableMap), valuation(valuation) {
+            StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, StateValuations const* valuations, storm::storage::sparse::state_type const& state) : variableMap(variableMap), valuations(valuations), state(state) {
                 // Intentionally left empty.
             }
             
             StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::begin() const {
-                return StateValueIterator(variableMap.cbegin(), valuation);
+                return StateValueIterator(variableMap.cbegin(), valuations, state);
             }
             
             StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::end() const {
-                return StateValueIterator(variableMap.cend(), valuation);
+                return StateValueIterator(variableMap.cend(), valuations, state);
             }
             
             bool StateValuations::getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const {
-                auto const& valuation = getValuation(stateIndex);
+                assertValuation(stateIndex);
                 STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
-                return valuation.booleanValues[variableToIndexMap.at(booleanVariable)];
+                return booleanValues[variableToIndexMap.at(booleanVariable)].get(stateIndex);
             }
             
-            int64_t const& StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
-                auto const& valuation = getValuation(stateIndex);
+            int64_t StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
+                assertValuation(stateIndex);
                 STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
-                return valuation.integerValues[variableToIndexMap.at(integerVariable)];
+                return integerValues[variableToIndexMap.at(integerVariable)].get(stateIndex);
             }
             
             storm::RationalNumber const& StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& rationalVariable) const {
-                auto const& valuation = getValuation(stateIndex);
+                assertValuation(stateIndex);
                 STORM_LOG_ASSERT(variableToIndexMap.count(rationalVariable) > 0, "Variable " << rationalVariable.getName() << " is not part of this valuation.");
-                return valuation.rationalValues[variableToIndexMap.at(rationalVariable)];
+                return rationalValues[variableToIndexMap.at(rationalVariable)][stateIndex];
             }
             
             bool StateValuations::isEmpty(storm::storage::sparse::state_type const& stateIndex) const {
-                auto const& valuation = getValuation(stateIndex);
-                return valuation.booleanValues.empty() && valuation.integerValues.empty() && valuation.rationalValues.empty();
+                STORM_LOG_ASSERT(stateIndex < numberOfStates, "Invalid state index.");
+                return variableToIndexMap.empty() || !nonEmptyStates.get(stateIndex);
             }
             
             std::string StateValuations::toString(storm::storage::sparse::state_type const& stateIndex, bool pretty, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables) const {
+                std::stringstream stream;
+                printValuation(stream, stateIndex, pretty, selectedVariables);
+                return stream.str();
+            }
+
+            void StateValuations::printValuation(std::ostream& out, storm::storage::sparse::state_type const& stateIndex, bool pretty, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables) const {
                 auto const& valueAssignment = at(stateIndex);
                 typename std::set<storm::expressions::Variable>::const_iterator setIt;
                 if (selectedVariables) {
                     setIt = selectedVariables->begin();
                 }
-                std::vector<std::string> assignments;
+                out << "[";
+                bool first = true;
                 for (auto valIt = valueAssignment.begin(); valIt != valueAssignment.end(); ++valIt) {
-                    if (selectedVariables && (*setIt != valIt.getVariable())) {
+                    if (selectedVariables && (setIt == selectedVariables->end() || *setIt != valIt.getVariable())) {
                         continue;
                     }
                  
-                    std::stringstream stream;
+                    if (first) {
+                        first = false;
+                    } else {
+                        out << (pretty ? "\t& " : "\t");
+                    }
+
                     if (pretty) {
                         if (valIt.isBoolean() && !valIt.getBooleanValue()) {
-                            stream << "!";
+                            out << "!";
                         }
-                        stream << valIt.getVariable().getName();
+                        out << valIt.getVariable().getName();
                         if (valIt.isInteger()) {
-                            stream << "=" << valIt.getIntegerValue();
+                            out << "=" << valIt.getIntegerValue();
                         } else if (valIt.isRational()) {
-                            stream << "=" << valIt.getRationalValue();
+                            out << "=" << valIt.getRationalValue();
                         } else {
                             STORM_LOG_THROW(valIt.isBoolean(), storm::exceptions::InvalidTypeException, "Unexpected variable type.");
                         }
                     } else {
                         if (valIt.isBoolean()) {
-                            stream << std::boolalpha << valIt.getBooleanValue() << std::noboolalpha;
+                            out << std::boolalpha << valIt.getBooleanValue() << std::noboolalpha;
                         } else if (valIt.isInteger()) {
-                            stream << valIt.getIntegerValue();
+                            out << valIt.getIntegerValue();
                         } else if (valIt.isRational()) {
-                            stream << valIt.getRationalValue();
+                            out << valIt.getRationalValue();
                         }
                     }
-                    assignments.push_back(stream.str());
                     
                     if (selectedVariables) {
                         // Go to next selected position
@@ -140,12 +314,7 @@ namespace storm {
                     }
                 }
                 STORM_LOG_ASSERT(!selectedVariables || setIt == selectedVariables->end(), "Valuation does not consider selected variable " << setIt->getName() << ".");
-
-                if (pretty) {
-                    return "[" + boost::join(assignments, "\t& ") + "]";
-                } else {
-                    return "[" + boost::join(assignments, "\t") + "]";
-                }
+                out << "]";
             }
             
             typename StateValuations::Json StateValuations::toJson(storm::storage::sparse::state_type const& stateIndex, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables) const {
@@ -156,7 +325,7 @@ namespace storm {
                 }
                 Json result;
                 for (auto valIt = valueAssignment.begin(); valIt != valueAssignment.end(); ++valIt) {
-                    if (selectedVariables && (*setIt != valIt.getVariable())) {
+                    if (selectedVariables && (setIt == selectedVariables->end() || *setIt != valIt.getVariable())) {
                         continue;
                     }
                     
@@ -177,40 +346,34 @@ namespace storm {
                 return result;
             }
             
-            bool StateValuations::assertValuation(StateValuation const& valuation) const {
-                storm::storage::BitVector foundBooleanValues(valuation.booleanValues.size(), false);
-                storm::storage::BitVector foundIntegerValues(valuation.integerValues.size(), false);
-                storm::storage::BitVector foundRationalValues(valuation.rationalValues.size(), false);
-                for (auto const& varIndex : variableToIndexMap) {
-                    storm::storage::BitVector* bv;
-                    if (varIndex.first.hasBooleanType()) {
-                        bv = &foundBooleanValues;
-                    } else if (varIndex.first.hasIntegerType()) {
-                        bv = &foundIntegerValues;
-                    } else if (varIndex.first.hasRationalType()) {
-                        bv = &foundRationalValues;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unexpected variable type.");
+            typename StateValuations::Json StateValuations::toJson(storm::storage::BitVector const& selectedStates, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables) const {
+                // Determine the considered variables only once.
+                std::vector<std::map<storm::expressions::Variable, uint64_t>::const_iterator> variables;
+                for (auto varIt = variableToIndexMap.begin(); varIt != variableToIndexMap.end(); ++varIt) {
+                    if (!selectedVariables || selectedVariables->count(varIt->first) > 0) {
+                        variables.push_back(varIt);
                     }
-                    if (varIndex.second < bv->size()) {
-                        if (bv->get(varIndex.second)) {
-                            STORM_LOG_ERROR("Multiple variables refer to the same value index");
-                            return false;
+                }
+
+                Json result = Json::array();
+                for (auto const& state : selectedStates) {
+                    STORM_LOG_ASSERT(state < numberOfStates, "Invalid state index.");
+                    Json stateValuation;
+                    if (nonEmptyStates.get(state)) {
+                        for (auto const& varIt : variables) {
+                            if (varIt->first.hasBooleanType()) {
+                                stateValuation[varIt->first.getName()] = booleanValues[varIt->second].get(state);
+                            } else if (varIt->first.hasIntegerType()) {
+                                stateValuation[varIt->first.getName()] = integerValues[varIt->second].get(state);
+                            } else {
+                                STORM_LOG_ASSERT(varIt->first.hasRationalType(), "Unexpected variable type.");
+                                stateValuation[varIt->first.getName()] = rationalValues[varIt->second][state];
+                            }
                         }
-                        bv->set(varIndex.second, true);
-                    } else {
-                        STORM_LOG_ERROR("Valuation does not provide a value for all variables");
-                        return false;
                     }
+                    result.push_back(std::move(stateValuation));
                 }
-                if (!(foundBooleanValues.full() && foundIntegerValues.full() && foundRationalValues.full())) {
-                    STORM_LOG_ERROR("Valuation has too many entries.");
-                }
-                return true;
-            }
-            
-            StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations) : variableToIndexMap(variableToIndexMap), valuations(valuations) {
-                // Intentionally left empty
+                return result;
             }
             
             std::string StateValuations::getStateInfo(state_type const& state) const {
@@ -220,11 +383,11 @@ namespace storm {
             
             typename StateValuations::StateValueIteratorRange StateValuations::at(state_type const& state) const {
                 STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
-                return StateValueIteratorRange({variableToIndexMap, &(valuations[state])});
+                return StateValueIteratorRange(variableToIndexMap, this, state);
             }
             
             uint_fast64_t StateValuations::getNumberOfStates() const {
-                return valuations.size();
+                return numberOfStates;
             }
 
             std::size_t StateValuations::hash() const {
@@ -232,28 +395,21 @@ namespace storm {
             }
             
             StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-                return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+                std::vector<storm::storage::sparse::state_type> selectedStateIndices;
+                selectedStateIndices.reserve(selectedStates.getNumberOfSetBits());
+                for (auto const& selectedState : selectedStates) {
+                    selectedStateIndices.push_back(selectedState);
+                }
+                return StateValuations(*this, selectedStateIndices);
             }
 
             StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
-                std::vector<StateValuation> selectedValuations;
-                selectedValuations.reserve(selectedStates.size());
-                for (auto const& selectedState : selectedStates){
-                    if (selectedState < valuations.size()) {
-                        selectedValuations.push_back(valuations[selectedState]);
-                    } else {
-                        selectedValuations.emplace_back();
-                    }
-                }
-                return StateValuations(variableToIndexMap, std::move(selectedValuations));
+                return StateValuations(*this, selectedStates);
             }
 
             StateValuations StateValuations::blowup(const std::vector<uint64_t> &mapNewToOld) const {
-                std::vector<StateValuation> newValuations;
-                for( auto const& oldState : mapNewToOld) {
-                    newValuations.push_back(valuations[oldState]);
-                }
-                return StateValuations(variableToIndexMap, std::move(newValuations));
+                STORM_LOG_ASSERT(std::all_of(mapNewToOld.begin(), mapNewToOld.end(), [this] (uint64_t oldState) { return oldState < numberOfStates; }), "Invalid state index.");
+                return StateValuations(*this, mapNewToOld);
             }
             
             StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0) {
@@ -261,36 +417,62 @@ namespace storm {
             }
             
             void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable) {
-                STORM_LOG_ASSERT(currentStateValuations.valuations.empty(), "Tried to add a variable, although a state has already been added before.");
+                STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add a variable, although a state has already been added before.");
                 STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
                 if (variable.hasBooleanType()) {
                     currentStateValuations.variableToIndexMap[variable] = booleanVarCount++;
+                    currentStateValuations.booleanValues.emplace_back();
                 }
                 if (variable.hasIntegerType()) {
                     currentStateValuations.variableToIndexMap[variable] = integerVarCount++;
+                    currentStateValuations.integerValues.emplace_back();
                 }
                 if (variable.hasRationalType()) {
                     currentStateValuations.variableToIndexMap[variable] = rationalVarCount++;
+                    currentStateValuations.rationalValues.emplace_back();
                 }
             }
             
+            void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound) {
+                STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add a variable, although a state has already been added before.");
+                STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
+                STORM_LOG_ASSERT(variable.hasIntegerType(), "Bounds can only be given for integer variables.");
+                currentStateValuations.variableToIndexMap[variable] = integerVarCount++;
+                currentStateValuations.integerValues.emplace_back(lowerBound, upperBound);
+            }
+
             void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues) {
-                if (state > currentStateValuations.valuations.size()) {
-                    currentStateValuations.valuations.resize(state);
-                }
-                if (state == currentStateValuations.valuations.size()) {
-                    currentStateValuations.valuations.emplace_back(std::move(booleanValues), std::move(integerValues), std::move(rationalValues));
+                if (state >= currentStateValuations.numberOfStates) {
+                    currentStateValuations.resizeColumns(state + 1, false);
                 } else {
                     STORM_LOG_ASSERT(currentStateValuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
-                    currentStateValuations.valuations[state] = typename StateValuations::StateValuation(std::move(booleanValues), std::move(integerValues), std::move(rationalValues));
                 }
+                if (booleanValues.empty() && integerValues.empty() && rationalValues.empty()) {
+                    // The state obtains an empty valuation.
+                    return;
+                }
+                STORM_LOG_ASSERT(booleanValues.size() == booleanVarCount && integerValues.size() == integerVarCount && rationalValues.size() == rationalVarCount, "Number of values does not match the number of variables.");
+
+                for (uint64_t index = 0; index < booleanValues.size(); ++index) {
+                    currentStateValuations.booleanValues[index].set(state, booleanValues[index]);
+                }
+                for (uint64_t index = 0; index < integerValues.size(); ++index) {
+                    currentStateValuations.integerValues[index].set(state, integerValues[index]);
+                }
+                for (uint64_t index = 0; index < rationalValues.size(); ++index) {
+                    currentStateValuations.rationalValues[index][state] = std::move(rationalValues[index]);
+                }
+                currentStateValuations.nonEmptyStates.set(state);
             }
             
             StateValuations StateValuationsBuilder::build(std::size_t totalStateCount) {
-                return std::move(currentStateValuations);
+                currentStateValuations.resizeColumns(std::max(static_cast<uint64_t>(totalStateCount), currentStateValuations.numberOfStates), true);
+                StateValuations result = std::move(currentStateValuations);
+                currentStateValuations = StateValuations();
                 booleanVarCount = 0;
                 integerVarCount = 0;
                 rationalVarCount = 0;
+                return result;
             }
         }
     }
@@ -17,27 +17,16 @@ namespace storm {
             class StateValuationsBuilder;
             
             // A structure holding information about the reachable state space that can be retrieved from the outside.
+            // The values are stored column-wise, i.e., for each variable the values of all states are stored consecutively.
+            // Boolean and integer values are bit-packed.
             class StateValuations : public storm::models::sparse::StateAnnotation {
             public:
                 friend class StateValuationsBuilder;
                 typedef storm::json<storm::RationalNumber> Json;
 
-                class StateValuation {
-                public:
-                    friend class StateValuations;
-                    StateValuation() = default;
-                    StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues);
-    
-                private:
-                    
-                    std::vector<bool> booleanValues;
-                    std::vector<int64_t> integerValues;
-                    std::vector<storm::RationalNumber> rationalValues;
-                };
-                
                 class StateValueIterator {
                 public:
-                    StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt, StateValuation const* valuation);
+                    StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt, StateValuations const* valuations, storm::storage::sparse::state_type const& state);
                     bool operator==(StateValueIterator const& other);
                     bool operator!=(StateValueIterator const& other);
                     StateValueIterator& operator++();
@@ -55,26 +44,28 @@ namespace storm {
                     
                 private:
                     typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt;
-                    StateValuation const* const valuation;
+                    StateValuations const* const valuations;
+                    storm::storage::sparse::state_type const state;
                 };
                 
                 class StateValueIteratorRange {
                 public:
-                    StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, StateValuation const* valuation);
+                    StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, StateValuations const* valuations, storm::storage::sparse::state_type const& state);
                     StateValueIterator begin() const;
                     StateValueIterator end() const;
                 private:
                     std::map<storm::expressions::Variable, uint64_t> const& variableMap;
-                    StateValuation const* const valuation;
+                    StateValuations const* const valuations;
+                    storm::storage::sparse::state_type const state;
                 };
                 
-                StateValuations() = default;
+                StateValuations();
                 virtual ~StateValuations() = default;
                 virtual std::string getStateInfo(storm::storage::sparse::state_type const& state) const override;
                 StateValueIteratorRange at(storm::storage::sparse::state_type const& state) const;
                 
                 bool getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const;
-                int64_t const& getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
+                int64_t getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
                 storm::RationalNumber const& getRationalValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& rationalVariable) const;
                 /// Returns true, if this valuation does not contain any value.
                 bool isEmpty(storm::storage::sparse::state_type const& stateIndex) const;
@@ -87,12 +78,26 @@ namespace storm {
                  */
                 std::string toString(storm::storage::sparse::state_type const& stateIndex, bool pretty = true, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables = boost::none) const;
                 
+                /*!
+                 * Writes the string representation of the valuation (as returned by toString) to the given stream.
+                 * In contrast to toString, this does not create intermediate strings and is therefore to be preferred
+                 * when exporting the valuations of many states.
+                 */
+                void printValuation(std::ostream& out, storm::storage::sparse::state_type const& stateIndex, bool pretty = true, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables = boost::none) const;
+                
                 /*!
                  * Returns a JSON representation of this valuation
                  * @param selectedVariables If given, only the informations for the variables in this set are processed.
                  * @return
                  */
                 Json toJson(storm::storage::sparse::state_type const& stateIndex, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables = boost::none) const;
+                
+                /*!
+                 * Returns a JSON array containing the valuations of all selected states (in ascending order).
+                 * @param selectedStates The states whose valuations are exported.
+                 * @param selectedVariables If given, only the informations for the variables in this set are processed.
+                 */
+                Json toJson(storm::storage::BitVector const& selectedStates, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables = boost::none) const;
 
                 
                 // Returns the (current) number of states that this object describes.
@@ -114,14 +119,72 @@ namespace storm {
                 virtual std::size_t hash() const;
                 
             private:
-                StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
-                bool assertValuation(StateValuation const& valuation) const;
-                StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
+                /*!
+                 * Stores the values of a single integer variable for all states. The values are stored relative to a
+                 * lower bound using as few bits as the range of the values requires. Setting a value outside of the
+                 * current range repacks all values.
+                 */
+                class IntegerColumn {
+                public:
+                    /*!
+                     * Creates an empty column whose initial range is given by the bounds.
+                     */
+                    IntegerColumn(int64_t lowerBound = 0, int64_t upperBound = 0);
+                    
+                    int64_t get(uint64_t index) const;
+                    void set(uint64_t index, int64_t value);
+                    
+                    /*!
+                     * Changes the number of values to the given size. The storage is only reallocated if necessary and
+                     * may become larger than required.
+                     */
+                    void grow(uint64_t newSize);
+                    
+                    /*!
+                     * Changes the number of values to the given size and releases unused storage.
+                     */
+                    void resize(uint64_t newSize);
+                    
+                    /*!
+                     * Retrieves the range of values that can be stored without repacking.
+                     */
+                    int64_t getLowerBound() const;
+                    int64_t getUpperBound() const;
+                    
+                    /*!
+                     * Retrieves the number of bits that are used per value.
+                     */
+                    uint64_t getBitWidth() const;
+                    
+                private:
+                    void repack(int64_t newLowerBound, uint64_t newBitWidth, uint64_t newCapacity);
+                    
+                    int64_t lowerBound;
+                    uint64_t bitWidth;
+                    uint64_t size;
+                    storm::storage::BitVector bits;
+                };
+                
+                /*!
+                 * Creates valuations that hold the values of the selected states of the given valuations. States whose
+                 * index is out of range obtain an empty valuation.
+                 */
+                StateValuations(StateValuations const& other, std::vector<storm::storage::sparse::state_type> const& selectedStates);
+                void assertValuation(storm::storage::sparse::state_type const& stateIndex) const;
+                void resizeColumns(uint64_t newNumberOfStates, bool exact);
                 
                 std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
-                // A mapping from state indices to their variable valuations.
-                std::vector<StateValuation> valuations;
                 
+                // The number of states that this object describes.
+                uint64_t numberOfStates;
+                
+                // The states that have a valuation.
+                storm::storage::BitVector nonEmptyStates;
+                
+                // For each variable the values of all states.
+                std::vector<storm::storage::BitVector> booleanValues;
+                std::vector<IntegerColumn> integerValues;
+                std::vector<std::vector<storm::RationalNumber>> rationalValues;
             };
             
             class StateValuationsBuilder {
@@ -133,6 +196,13 @@ namespace storm {
                  */
                 void addVariable(storm::expressions::Variable const& variable);
                 
+                /*!
+                 * Adds a new integer variable whose values are expected to lie within the given bounds. The bounds are
+                 * only used to choose a compact representation of the values, i.e., values outside of the bounds are
+                 * still allowed.
+                 */
+                void addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound);
+                
                 /*!
                  * Adds a new state.
                  * The variable values have to be given in the same order as the variables have been added.
@@ -0,0 +1,121 @@
+#include "storm/transformer/StatePermuter.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/ChoiceOrigins.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/permutation.h"
+#include "storm/utility/vector.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace transformer {
+
+        namespace detail {
+            /*!
+             * Permutes the row groups given by the row group indices as well as the columns of the given matrix.
+             */
+            template<typename MatrixValueType>
+            storm::storage::SparseMatrix<MatrixValueType> permuteMatrix(storm::storage::SparseMatrix<MatrixValueType> const& matrix, std::vector<uint64_t> const& rowGroupIndices, std::vector<uint64_t> const& stateOrder, std::vector<uint64_t> const& newStateIndices) {
+                bool hasCustomRowGrouping = !matrix.hasTrivialRowGrouping();
+                storm::storage::SparseMatrixBuilder<MatrixValueType> builder(matrix.getRowCount(), matrix.getColumnCount(), matrix.getEntryCount(), true, hasCustomRowGrouping, hasCustomRowGrouping ? stateOrder.size() : 0);
+                std::vector<std::pair<uint64_t, MatrixValueType>> rowEntries;
+                uint64_t newRow = 0;
+                for (auto const& state : stateOrder) {
+                    if (hasCustomRowGrouping) {
+                        builder.newRowGroup(newRow);
+                    }
+                    for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row, ++newRow) {
+                        // The new columns of a row are no longer sorted.
+                        rowEntries.clear();
+                        for (auto const& entry : matrix.getRow(row)) {
+                            rowEntries.emplace_back(newStateIndices[entry.getColumn()], entry.getValue());
+                        }
+                        std::sort(rowEntries.begin(), rowEntries.end(), [] (std::pair<uint64_t, MatrixValueType> const& first, std::pair<uint64_t, MatrixValueType> const& second) { return first.first < second.first; });
+                        for (auto const& columnValuePair : rowEntries) {
+                            builder.addNextValue(newRow, columnValuePair.first, columnValuePair.second);
+                        }
+                    }
+                }
+                return builder.build();
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> StatePermuter<ValueType, RewardModelType>::permuteStates(storm::models::sparse::Model<ValueType, RewardModelType> const& model, std::vector<uint64_t> const& stateOrder) {
+            STORM_LOG_THROW(stateOrder.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The order of states does not match the number of states.");
+            STORM_LOG_THROW(!model.isOfType(storm::models::ModelType::S2pg), storm::exceptions::NotSupportedException, "Renumbering the states of " << model.getType() << " is not supported.");
+            std::vector<uint64_t> newStateIndices = storm::utility::permutation::invertPermutation(stateOrder);
+
+            // Determine the order of the choices, which follows the order of their states.
+            std::vector<uint64_t> const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+            std::vector<uint64_t> choiceOrder;
+            choiceOrder.reserve(model.getNumberOfChoices());
+            for (auto const& state : stateOrder) {
+                for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                    choiceOrder.push_back(choice);
+                }
+            }
+
+            storm::models::sparse::StateLabeling stateLabeling = model.getStateLabeling();
+            stateLabeling.permuteItems(stateOrder);
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(detail::permuteMatrix(model.getTransitionMatrix(), rowGroupIndices, stateOrder, newStateIndices), std::move(stateLabeling));
+
+            for (auto const& rewardModel : model.getRewardModels()) {
+                boost::optional<std::vector<typename RewardModelType::ValueType>> stateRewardVector;
+                if (rewardModel.second.hasStateRewards()) {
+                    stateRewardVector = storm::utility::vector::applyInversePermutation(stateOrder, rewardModel.second.getStateRewardVector());
+                }
+                boost::optional<std::vector<typename RewardModelType::ValueType>> stateActionRewardVector;
+                if (rewardModel.second.hasStateActionRewards()) {
+                    stateActionRewardVector = storm::utility::vector::applyInversePermutation(choiceOrder, rewardModel.second.getStateActionRewardVector());
+                }
+                boost::optional<storm::storage::SparseMatrix<typename RewardModelType::ValueType>> transitionRewardMatrix;
+                if (rewardModel.second.hasTransitionRewards()) {
+                    transitionRewardMatrix = detail::permuteMatrix(rewardModel.second.getTransitionRewardMatrix(), rowGroupIndices, stateOrder, newStateIndices);
+                }
+                components.rewardModels.emplace(rewardModel.first, RewardModelType(std::move(stateRewardVector), std::move(stateActionRewardVector), std::move(transitionRewardMatrix)));
+            }
+
+            if (model.hasChoiceLabeling()) {
+                components.choiceLabeling = model.getChoiceLabeling();
+                components.choiceLabeling->permuteItems(choiceOrder);
+            }
+            if (model.hasStateValuations()) {
+                components.stateValuations = model.getStateValuations().selectStates(std::vector<storm::storage::sparse::state_type>(stateOrder.begin(), stateOrder.end()));
+            }
+            if (model.hasChoiceOrigins()) {
+                components.choiceOrigins = model.getChoiceOrigins()->selectChoices(std::vector<uint_fast64_t>(choiceOrder.begin(), choiceOrder.end()));
+            }
+
+            if (model.isOfType(storm::models::ModelType::Ctmc)) {
+                // The transition matrix of a CTMC holds the rates.
+                components.rateTransitions = true;
+                components.exitRates = storm::utility::vector::applyInversePermutation(stateOrder, static_cast<storm::models::sparse::Ctmc<ValueType, RewardModelType> const&>(model).getExitRateVector());
+            } else if (model.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                auto const& ma = static_cast<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType> const&>(model);
+                components.markovianStates = ma.getMarkovianStates().permute(stateOrder);
+                components.exitRates = storm::utility::vector::applyInversePermutation(stateOrder, ma.getExitRates());
+            } else if (model.isOfType(storm::models::ModelType::Pomdp)) {
+                components.observabilityClasses = storm::utility::vector::applyInversePermutation(stateOrder, static_cast<storm::models::sparse::Pomdp<ValueType, RewardModelType> const&>(model).getObservations());
+            }
+
+            return storm::utility::builder::buildModelFromComponents(model.getType(), std::move(components));
+        }
+
+        template class StatePermuter<double>;
+#ifdef STORM_HAVE_CARL
+        template class StatePermuter<storm::RationalNumber>;
+        template class StatePermuter<storm::RationalFunction>;
+#endif
+    }
+}
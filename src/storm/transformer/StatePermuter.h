@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace transformer {
+
+        /*!
+         * Renumbers the states of a sparse model. Since the indices of the states determine the memory access pattern
+         * of the matrix-vector multiplications performed by the solvers, a suitable numbering can improve their
+         * cache locality.
+         */
+        template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+        class StatePermuter {
+        public:
+            /*!
+             * Creates a model in which the states of the given model appear in the given order. The choices of each
+             * state keep their relative order. Labelings, reward models, state valuations, choice origins and the
+             * components that are specific to the model type are permuted accordingly.
+             *
+             * @param model The model whose states to renumber.
+             * @param stateOrder The states in their new order, i.e. the i-th entry is the index of the state of the
+             * given model that obtains index i.
+             * @return The renumbered model.
+             */
+            static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> permuteStates(storm::models::sparse::Model<ValueType, RewardModelType> const& model, std::vector<uint64_t> const& stateOrder);
+        };
+
+    }
+}
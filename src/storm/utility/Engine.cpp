@@ -101,6 +101,18 @@ namespace storm {
                     return storm::builder::BuilderType::Explicit;
             }
         }
+        
+        Engine getDdMemoryFallbackEngine(Engine const& engine) {
+            switch (engine) {
+                case Engine::Dd:
+                    return Engine::Hybrid;
+                case Engine::Hybrid:
+                case Engine::DdSparse:
+                    return Engine::Sparse;
+                default:
+                    return Engine::Unknown;
+            }
+        }
 
         template <typename ValueType>
         bool canHandle(storm::utility::Engine const& engine, storm::storage::SymbolicModelDescription::ModelType const& modelType, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
@@ -59,6 +59,12 @@ namespace storm {
          */
         storm::builder::BuilderType getBuilderType(storm::utility::Engine const& engine);
         
+        /*!
+         * Returns the engine to fall back to if the given engine exceeds the memory budget of the DD library, i.e. an
+         * engine that relies less on decision diagrams. If there is no such engine, Engine::Unknown is returned.
+         */
+        Engine getDdMemoryFallbackEngine(storm::utility::Engine const& engine);
+        
         /*!
          * Returns false if the given model description and one of the given properties can certainly not be handled by the given engine.
          * Notice that the set of handable model checking queries is only overapproximated, i.e. if this returns true,
@@ -3,16 +3,21 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 namespace storm {
+    /*!
+     * SupportsConcurrency indicates whether values of the type may be processed by multiple threads at the same time.
+     */
     template<typename ValueType>
     struct NumberTraits {
         static const bool SupportsExponential = false;
         static const bool IsExact = false;
+        static const bool SupportsConcurrency = false;
     };
     
     template<>
     struct NumberTraits<double> {
         static const bool SupportsExponential = true;
         static const bool IsExact = false;
+        static const bool SupportsConcurrency = true;
         
         typedef uint64_t IntegerType;
     };
@@ -22,6 +27,8 @@ namespace storm {
     struct NumberTraits<storm::ClnRationalNumber> {
         static const bool SupportsExponential = false;
         static const bool IsExact = true;
+        // Copies of CLN numbers share their representation via non-atomic reference counts.
+        static const bool SupportsConcurrency = false;
 
         typedef cln::cl_I IntegerType;
     };
@@ -32,6 +39,8 @@ namespace storm {
     struct NumberTraits<storm::GmpRationalNumber> {
         static const bool SupportsExponential = false;
         static const bool IsExact = true;
+        // The concurrent code paths are only instantiated for doubles, so exact computations stay sequential.
+        static const bool SupportsConcurrency = false;
 
         typedef mpz_class IntegerType;
     };
@@ -41,5 +50,7 @@ namespace storm {
     struct NumberTraits<storm::RationalFunction> {
         static const bool SupportsExponential = false;
         static const bool IsExact = true;
+        // Rational functions share the polynomial cache of their factorization and are based on CLN or GMP numbers.
+        static const bool SupportsConcurrency = false;
     };
 }
@@ -34,6 +34,7 @@ namespace storm {
                     }
                     
                     reachableStates |= newReachableStates;
+                    reachableStates.getDdManager().checkMemoryBudget();
 
                     ++iteration;
                     STORM_LOG_TRACE("Iteration " << iteration << " of reachability computation completed: " << reachableStates.getNonZeroCount() << " reachable states found.");
@@ -66,6 +67,7 @@ namespace storm {
                     }
                     
                     reachableStates |= newReachableStates;
+                    reachableStates.getDdManager().checkMemoryBudget();
                     
                     ++iteration;
                     STORM_LOG_TRACE("Iteration " << iteration << " of (backward) reachability computation completed: " << reachableStates.getNonZeroCount() << " reachable states found.");
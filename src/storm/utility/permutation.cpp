@@ -0,0 +1,172 @@
+#include "storm/utility/permutation.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+        namespace permutation {
+
+            std::string orderKindToString(OrderKind const& order) {
+                switch (order) {
+                    case OrderKind::Bfs:
+                        return "bfs";
+                    case OrderKind::ReverseCuthillMcKee:
+                        return "rcm";
+                    case OrderKind::SccTopological:
+                        return "scc";
+                }
+                STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown order kind.");
+            }
+
+            std::vector<OrderKind> getOrderKinds() {
+                return {OrderKind::Bfs, OrderKind::ReverseCuthillMcKee, OrderKind::SccTopological};
+            }
+
+            template<typename ValueType>
+            std::vector<uint64_t> createBfsOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates) {
+                uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                std::vector<uint64_t> result;
+                result.reserve(numberOfStates);
+                storm::storage::BitVector visited(numberOfStates);
+
+                // The result also serves as the queue of the search. States that are not reachable from the initial
+                // states start further searches in the order of their indices.
+                uint64_t head = 0;
+                auto startState = initialStates.begin();
+                uint64_t nextUnvisitedState = 0;
+                while (result.size() < numberOfStates) {
+                    if (head == result.size()) {
+                        while (startState != initialStates.end() && visited.get(*startState)) {
+                            ++startState;
+                        }
+                        uint64_t state;
+                        if (startState != initialStates.end()) {
+                            state = *startState;
+                        } else {
+                            nextUnvisitedState = visited.getNextUnsetIndex(nextUnvisitedState);
+                            state = nextUnvisitedState;
+                        }
+                        visited.set(state);
+                        result.push_back(state);
+                    }
+
+                    // The entries of each row are sorted by column, so successors are visited by increasing index.
+                    // Visiting all choices of a state before the next state keeps the states explored together close.
+                    uint64_t state = result[head++];
+                    for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+                        if (!visited.get(entry.getColumn())) {
+                            visited.set(entry.getColumn());
+                            result.push_back(entry.getColumn());
+                        }
+                    }
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            std::vector<uint64_t> createReverseCuthillMcKeeOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose(true);
+
+                // The degree of a state in the underlying undirected graph is approximated by the number of its
+                // outgoing and incoming transitions.
+                std::vector<uint64_t> degrees(numberOfStates);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    degrees[state] = transitionMatrix.getRowGroupEntryCount(state) + backwardTransitions.getRowGroupEntryCount(state);
+                }
+                auto byDegree = [&degrees] (uint64_t const& first, uint64_t const& second) {
+                    return degrees[first] < degrees[second] || (degrees[first] == degrees[second] && first < second);
+                };
+
+                // Every component of the graph is started from the unvisited state of minimal degree.
+                std::vector<uint64_t> statesByDegree(numberOfStates);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    statesByDegree[state] = state;
+                }
+                std::sort(statesByDegree.begin(), statesByDegree.end(), byDegree);
+                auto startState = statesByDegree.begin();
+
+                std::vector<uint64_t> result;
+                result.reserve(numberOfStates);
+                storm::storage::BitVector visited(numberOfStates);
+                std::vector<uint64_t> neighbors;
+                uint64_t head = 0;
+                while (result.size() < numberOfStates) {
+                    if (head == result.size()) {
+                        while (visited.get(*startState)) {
+                            ++startState;
+                        }
+                        visited.set(*startState);
+                        result.push_back(*startState);
+                    }
+
+                    uint64_t state = result[head++];
+                    neighbors.clear();
+                    for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+                        if (!visited.get(entry.getColumn())) {
+                            visited.set(entry.getColumn());
+                            neighbors.push_back(entry.getColumn());
+                        }
+                    }
+                    for (auto const& entry : backwardTransitions.getRow(state)) {
+                        if (!visited.get(entry.getColumn())) {
+                            visited.set(entry.getColumn());
+                            neighbors.push_back(entry.getColumn());
+                        }
+                    }
+                    std::sort(neighbors.begin(), neighbors.end(), byDegree);
+                    result.insert(result.end(), neighbors.begin(), neighbors.end());
+                }
+
+                std::reverse(result.begin(), result.end());
+                return result;
+            }
+
+            template<typename ValueType>
+            std::vector<uint64_t> createSccTopologicalOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+                std::vector<uint64_t> result;
+                result.reserve(transitionMatrix.getRowGroupCount());
+                for (auto const& scc : sccDecomposition) {
+                    result.insert(result.end(), scc.begin(), scc.end());
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            std::vector<uint64_t> createStateOrder(OrderKind const& order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates) {
+                switch (order) {
+                    case OrderKind::Bfs:
+                        return createBfsOrder(transitionMatrix, initialStates);
+                    case OrderKind::ReverseCuthillMcKee:
+                        return createReverseCuthillMcKeeOrder(transitionMatrix);
+                    case OrderKind::SccTopological:
+                        return createSccTopologicalOrder(transitionMatrix);
+                }
+                STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown order kind.");
+            }
+
+            std::vector<uint64_t> invertPermutation(std::vector<uint64_t> const& permutation) {
+                std::vector<uint64_t> result(permutation.size());
+                for (uint64_t index = 0; index < permutation.size(); ++index) {
+                    result[permutation[index]] = index;
+                }
+                return result;
+            }
+
+            template std::vector<uint64_t> createStateOrder(OrderKind const& order, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::BitVector const& initialStates);
+#ifdef STORM_HAVE_CARL
+            template std::vector<uint64_t> createStateOrder(OrderKind const& order, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::BitVector const& initialStates);
+            template std::vector<uint64_t> createStateOrder(OrderKind const& order, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::BitVector const& initialStates);
+#endif
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+    }
+
+    namespace utility {
+        namespace permutation {
+
+            /*!
+             * The orders in which the states of a model can be renumbered.
+             */
+            enum class OrderKind {
+                // Breadth-first search from the initial states, visiting the successors of a state by increasing index.
+                Bfs,
+                // Reverse Cuthill-McKee on the underlying undirected graph, which keeps the indices of neighbors close.
+                ReverseCuthillMcKee,
+                // The states of each SCC consecutively, where every SCC only reaches the SCCs that precede it.
+                SccTopological
+            };
+
+            std::string orderKindToString(OrderKind const& order);
+            std::vector<OrderKind> getOrderKinds();
+
+            /*!
+             * Computes the order in which the states of the given system are to be renumbered.
+             *
+             * @param order The kind of order to compute.
+             * @param transitionMatrix The transition matrix of the system.
+             * @param initialStates The initial states of the system.
+             * @return The states in their new order, i.e. the i-th entry is the current index of the state that obtains
+             * index i. This is the inverse of the permutation that maps current indices to new ones.
+             */
+            template<typename ValueType>
+            std::vector<uint64_t> createStateOrder(OrderKind const& order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates);
+
+            /*!
+             * Inverts the given permutation.
+             */
+            std::vector<uint64_t> invertPermutation(std::vector<uint64_t> const& permutation);
+
+        }
+    }
+}
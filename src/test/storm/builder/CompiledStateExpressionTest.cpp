@@ -0,0 +1,109 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/CompiledStateExpression.h"
+
+namespace {
+    std::vector<storm::generator::CompressedState> enumerateStates(storm::generator::VariableInformation const& variableInformation) {
+        std::vector<storm::generator::CompressedState> result;
+        result.emplace_back(variableInformation.getTotalBitOffset(true));
+        for (auto const& integerVariable : variableInformation.integerVariables) {
+            std::vector<storm::generator::CompressedState> newResult;
+            for (auto const& state : result) {
+                for (int_fast64_t value = integerVariable.lowerBound; value <= integerVariable.upperBound; ++value) {
+                    newResult.push_back(state);
+                    newResult.back().setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, static_cast<uint_fast64_t>(value - integerVariable.lowerBound));
+                }
+            }
+            result = std::move(newResult);
+        }
+        return result;
+    }
+}
+
+TEST(CompiledStateExpressionTest, PrismGuardsAndAssignments) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::generator::VariableInformation variableInformation(program);
+    storm::generator::StateExpressionCompiler compiler(variableInformation);
+    storm::expressions::ExpressionEvaluator<double> evaluator(program.getManager());
+
+    std::vector<storm::generator::CompressedState> states = enumerateStates(variableInformation);
+    ASSERT_EQ(56ul, states.size());
+
+    for (auto const& command : program.getModule(0).getCommands()) {
+        boost::optional<storm::generator::CompiledStateExpression> compiledGuard = compiler.compile(command.getGuardExpression());
+        ASSERT_TRUE(static_cast<bool>(compiledGuard));
+        for (auto const& update : command.getUpdates()) {
+            for (auto const& assignment : update.getAssignments()) {
+                boost::optional<storm::generator::CompiledStateExpression> compiledAssignment = compiler.compile(assignment.getExpression());
+                ASSERT_TRUE(static_cast<bool>(compiledAssignment));
+                for (auto const& state : states) {
+                    storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+                    EXPECT_EQ(evaluator.asInt(assignment.getExpression()), compiledAssignment->evaluateAsInt(state));
+                }
+            }
+        }
+        for (auto const& state : states) {
+            storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+            EXPECT_EQ(evaluator.asBool(command.getGuardExpression()), compiledGuard->evaluateAsBool(state));
+        }
+    }
+}
+
+TEST(CompiledStateExpressionTest, Operators) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::generator::VariableInformation variableInformation(program);
+    storm::generator::StateExpressionCompiler compiler(variableInformation);
+    storm::expressions::ExpressionEvaluator<double> evaluator(program.getManager());
+    storm::expressions::ExpressionManager const& manager = program.getManager();
+
+    storm::expressions::Expression s = manager.getVariableExpression("s");
+    storm::expressions::Expression d = manager.getVariableExpression("d");
+    std::vector<storm::expressions::Expression> expressions = {
+        storm::expressions::ite(s > d, s - d, d * manager.integer(2)),
+        storm::expressions::minimum(s, d) + storm::expressions::maximum(s, manager.integer(3)),
+        storm::expressions::modulo(s + manager.integer(5), manager.integer(3)),
+        (d ^ manager.integer(2)) - s,
+        storm::expressions::floor(s / manager.integer(2)) + storm::expressions::ceil(d / manager.integer(4)),
+        -s + d
+    };
+    std::vector<storm::expressions::Expression> predicates = {
+        (s == manager.integer(3)) || !(d >= manager.integer(2)),
+        storm::expressions::implies(s < manager.integer(4), d != manager.integer(0)),
+        storm::expressions::iff(s <= d, d > manager.integer(1)),
+        storm::expressions::xclusiveor(s > manager.integer(2), d < manager.integer(5)) && (s + d >= manager.integer(6))
+    };
+
+    std::vector<storm::generator::CompressedState> states = enumerateStates(variableInformation);
+    for (auto const& expression : expressions) {
+        boost::optional<storm::generator::CompiledStateExpression> compiledExpression = compiler.compile(expression);
+        ASSERT_TRUE(static_cast<bool>(compiledExpression));
+        for (auto const& state : states) {
+            storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+            EXPECT_EQ(evaluator.asInt(expression), compiledExpression->evaluateAsInt(state)) << expression;
+        }
+    }
+    for (auto const& predicate : predicates) {
+        boost::optional<storm::generator::CompiledStateExpression> compiledPredicate = compiler.compile(predicate);
+        ASSERT_TRUE(static_cast<bool>(compiledPredicate));
+        for (auto const& state : states) {
+            storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+            EXPECT_EQ(evaluator.asBool(predicate), compiledPredicate->evaluateAsBool(state)) << predicate;
+        }
+    }
+}
+
+TEST(CompiledStateExpressionTest, UnknownVariable) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::generator::VariableInformation variableInformation(program);
+    storm::generator::StateExpressionCompiler compiler(variableInformation);
+
+    storm::expressions::ExpressionManager& manager = program.getManager();
+    storm::expressions::Variable x = manager.declareIntegerVariable("x");
+    EXPECT_FALSE(static_cast<bool>(compiler.compile(x.getExpression() > manager.getVariableExpression("s"))));
+}
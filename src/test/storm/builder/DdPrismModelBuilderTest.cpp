@@ -10,6 +10,12 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/utility/Engine.h"
+#include "storm/exceptions/DdMemoryBudgetExceededException.h"
 
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -77,6 +83,31 @@ TEST(DdPrismModelBuilderTest_Cudd, Dtmc) {
     EXPECT_EQ(2505ul, model->getNumberOfTransitions());
 }
 
+TEST(DdPrismModelBuilderTest_Cudd, MemoryBudgetFallback) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    
+    // A tiny budget is exceeded as soon as it is checked, e.g. during the symbolic reachability analysis.
+    storm::settings::mutableManager().setFromString("--cudd:budget 0.000001");
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    EXPECT_TRUE(manager->isMemoryBudgetExceeded());
+    STORM_SILENT_EXPECT_THROW(manager->checkMemoryBudget(), storm::exceptions::DdMemoryBudgetExceededException);
+    STORM_SILENT_EXPECT_THROW(storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program), storm::exceptions::DdMemoryBudgetExceededException);
+    
+    // The engines fall back to engines relying less on decision diagrams, eventually to the sparse engine, which
+    // is not affected by the budget.
+    EXPECT_EQ(storm::utility::Engine::Hybrid, storm::utility::getDdMemoryFallbackEngine(storm::utility::Engine::Dd));
+    EXPECT_EQ(storm::utility::Engine::Sparse, storm::utility::getDdMemoryFallbackEngine(storm::utility::Engine::Hybrid));
+    EXPECT_EQ(storm::utility::Engine::Sparse, storm::utility::getDdMemoryFallbackEngine(storm::utility::Engine::DdSparse));
+    EXPECT_EQ(storm::utility::Engine::Unknown, storm::utility::getDdMemoryFallbackEngine(storm::utility::Engine::Sparse));
+    std::shared_ptr<storm::models::sparse::Model<double>> sparseModel = storm::builder::ExplicitModelBuilder<double>(program).build();
+    EXPECT_EQ(13ul, sparseModel->getNumberOfStates());
+    
+    storm::settings::mutableManager().setFromString("--cudd:budget 0");
+    manager.reset(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    EXPECT_FALSE(manager->isMemoryBudgetExceeded());
+    EXPECT_NO_THROW(manager->checkMemoryBudget());
+}
+
 TEST(DdPrismModelBuilderTest_Sylvan, Ctmc) {
 
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
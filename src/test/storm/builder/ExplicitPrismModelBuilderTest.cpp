@@ -1,10 +1,56 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Mdp.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
+namespace {
+    typedef std::shared_ptr<storm::models::sparse::Model<double>> ModelPtr;
+    
+    // Builds the given program once with all labels and reward models and once with the given options.
+    std::pair<ModelPtr, ModelPtr> buildFullAndModifiedModel(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& options, storm::builder::ExplicitModelBuilder<double>::Options const& builderOptions = storm::builder::ExplicitModelBuilder<double>::Options()) {
+        ModelPtr fullModel = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(true, true)).build();
+        ModelPtr modifiedModel = storm::builder::ExplicitModelBuilder<double>(program, options, builderOptions).build();
+        return std::make_pair(fullModel, modifiedModel);
+    }
+    
+    // Checks that both models have the same states, transitions and labels.
+    void expectSameModel(storm::models::sparse::Model<double> const& fullModel, storm::models::sparse::Model<double> const& modifiedModel) {
+        EXPECT_EQ(fullModel.getNumberOfStates(), modifiedModel.getNumberOfStates());
+        EXPECT_EQ(fullModel.getNumberOfTransitions(), modifiedModel.getNumberOfTransitions());
+        EXPECT_EQ(fullModel.getInitialStates(), modifiedModel.getInitialStates());
+        EXPECT_TRUE(fullModel.getTransitionMatrix() == modifiedModel.getTransitionMatrix());
+        EXPECT_TRUE(fullModel.getStateLabeling() == modifiedModel.getStateLabeling());
+    }
+    
+    double checkInitialState(storm::models::sparse::Model<double> const& model, storm::logic::Formula const& formula) {
+        storm::Environment env;
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        if (model.isOfType(storm::models::ModelType::Dtmc)) {
+            result = storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>>(*model.as<storm::models::sparse::Dtmc<double>>()).check(env, formula);
+        } else {
+            result = storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>>(*model.as<storm::models::sparse::Mdp<double>>()).check(env, formula);
+        }
+        return result->asExplicitQuantitativeCheckResult<double>()[*model.getInitialStates().begin()];
+    }
+    
+    // Checks that the reduced model yields the same results as the full model for the given formulas.
+    void expectSameResults(storm::models::sparse::Model<double> const& fullModel, storm::models::sparse::Model<double> const& reducedModel, std::vector<std::string> const& formulaStrings) {
+        storm::parser::FormulaParser formulaParser;
+        for (auto const& formulaString : formulaStrings) {
+            std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+            EXPECT_NEAR(checkInitialState(fullModel, *formula), checkInitialState(reducedModel, *formula), 1e-6) << formulaString;
+        }
+    }
+}
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -125,3 +171,145 @@ TEST(ExplicitPrismModelBuilderTest, FailComposition) {
 
     STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program).build(), storm::exceptions::WrongFormatException);
 }
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    // Modules a and b are independent of each other and invisible, so their interleavings can be reduced.
+    std::string input = R"(
+mdp
+
+module a
+    x : [0..3] init 0;
+    [] x<3 -> (x'=x+1);
+endmodule
+
+module b
+    y : [0..3] init 0;
+    [] y<3 -> (y'=y+1);
+endmodule
+
+module c
+    z : [0..2] init 0;
+    [go] z=0 -> 0.5:(z'=1) + 0.5:(z'=2);
+    [stop] z=0 -> (z'=2);
+    [] z>0 -> true;
+endmodule
+
+label "goal" = z=1;
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "por.nm");
+    
+    storm::generator::NextStateGeneratorOptions options(true, true);
+    options.setPartialOrderReduction();
+    auto models = buildFullAndModifiedModel(program, options);
+    EXPECT_EQ(48ul, models.first->getNumberOfStates());
+    EXPECT_EQ(9ul, models.second->getNumberOfStates());
+    
+    expectSameResults(*models.first, *models.second, {"Pmax=? [F \"goal\"]", "Pmin=? [F \"goal\"]"});
+}
+
+#if defined(STORM_HAVE_Z3) || defined(STORM_HAVE_MSAT)
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    // The modules p2 and p3 are copies of p1 and the label is symmetric, so states only differing in the order of the
+    // values of x1, x2 and x3 can be merged.
+    std::string input = R"(
+mdp
+
+module p1
+    x1 : [0..2] init 0;
+    [] x1=0 -> 0.5:(x1'=1) + 0.5:(x1'=2);
+    [] x1>0 -> true;
+endmodule
+
+module p2 = p1 [x1=x2] endmodule
+module p3 = p1 [x1=x3] endmodule
+
+label "goal" = x1=1 & x2=1 & x3=1;
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "symmetry.nm");
+    
+    storm::generator::NextStateGeneratorOptions options(true, true);
+    options.setSymmetryReduction();
+    auto models = buildFullAndModifiedModel(program, options);
+    EXPECT_EQ(27ul, models.first->getNumberOfStates());
+    EXPECT_EQ(10ul, models.second->getNumberOfStates());
+    
+    expectSameResults(*models.first, *models.second, {"Pmax=? [F \"goal\"]", "Pmin=? [F \"goal\"]"});
+    
+    // A label that distinguishes the modules prevents the reduction.
+    storm::prism::Program asymmetricProgram = storm::parser::PrismParser::parseFromString(input + "label \"first\" = x1=1;\n", "symmetry.nm");
+    EXPECT_EQ(27ul, storm::builder::ExplicitModelBuilder<double>(asymmetricProgram, options).build()->getNumberOfStates());
+}
+#endif
+
+TEST(ExplicitPrismModelBuilderTest, ParallelExpansion) {
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.numberOfExplorationThreads = 4;
+    parallelOptions.explorationBatchSize = 16;
+    parallelOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    
+    // With a breadth-first exploration, states are expanded in the same order, so the parallel expansion yields the same model.
+    for (std::string const& filename : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(filename);
+        auto models = buildFullAndModifiedModel(program, storm::generator::NextStateGeneratorOptions(true, true), parallelOptions);
+        expectSameModel(*models.first, *models.second);
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, DeferredStateRewards) {
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.numberOfRewardThreads = 4;
+    
+    // Computing the state rewards after the exploration yields the same reward models.
+    for (std::string const& filename : {STORM_TEST_RESOURCES_DIR "/ctmc/embedded2.sm", STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm", STORM_TEST_RESOURCES_DIR "/dtmc/nand-5-2.pm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(filename, true);
+        storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+        generatorOptions.setDeferStateRewards();
+        auto models = buildFullAndModifiedModel(program, generatorOptions, parallelOptions);
+        expectSameModel(*models.first, *models.second);
+        
+        ASSERT_EQ(models.first->getNumberOfRewardModels(), models.second->getNumberOfRewardModels());
+        for (auto const& rewardModel : models.first->getRewardModels()) {
+            ASSERT_TRUE(models.second->hasRewardModel(rewardModel.first));
+            ASSERT_TRUE(rewardModel.second.hasStateRewards());
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), models.second->getRewardModel(rewardModel.first).getStateRewardVector());
+        }
+    }
+    
+    // Only the requested reward models are built.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/embedded2.sm", true);
+    storm::generator::NextStateGeneratorOptions generatorOptions(false, true);
+    generatorOptions.addRewardModel("danger");
+    generatorOptions.setDeferStateRewards();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+    EXPECT_EQ(1ul, model->getNumberOfRewardModels());
+    EXPECT_TRUE(model->hasRewardModel("danger"));
+}
+
+TEST(ExplicitPrismModelBuilderTest, BoundedExplorationDepth) {
+    storm::parser::FormulaParser formulaParser;
+    
+    // Only the states reachable within the step bound are expanded.
+    storm::prism::Program dtmcProgram = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    std::string dtmcFormulaString = "P=? [F<=12 \"observe0Greater1\"]";
+    storm::generator::NextStateGeneratorOptions dtmcOptions(*formulaParser.parseSingleFormulaFromString(dtmcFormulaString), dtmcProgram);
+    ASSERT_TRUE(dtmcOptions.hasMaximalExplorationDepth());
+    EXPECT_EQ(12ul, dtmcOptions.getMaximalExplorationDepth());
+    
+    auto dtmcModels = buildFullAndModifiedModel(dtmcProgram, dtmcOptions);
+    EXPECT_LT(dtmcModels.second->getNumberOfStates(), dtmcModels.first->getNumberOfStates());
+    expectSameResults(*dtmcModels.first, *dtmcModels.second, {dtmcFormulaString});
+    
+    storm::prism::Program mdpProgram = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    for (std::string const& formulaString : {"Pmax=? [F<=4 \"elected\"]", "Pmin=? [F<=4 \"elected\"]", "Pmax=? [X !\"elected\"]"}) {
+        storm::generator::NextStateGeneratorOptions mdpOptions(*formulaParser.parseSingleFormulaFromString(formulaString), mdpProgram);
+        ASSERT_TRUE(mdpOptions.hasMaximalExplorationDepth());
+        
+        auto mdpModels = buildFullAndModifiedModel(mdpProgram, mdpOptions);
+        EXPECT_LT(mdpModels.second->getNumberOfStates(), mdpModels.first->getNumberOfStates());
+        expectSameResults(*mdpModels.first, *mdpModels.second, {formulaString});
+    }
+    
+    // Formulas depending on an unbounded number of steps require the full exploration.
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formulaParser.parseSingleFormulaFromString("Pmax=? [F<=4 \"elected\"]"), formulaParser.parseSingleFormulaFromString("Pmax=? [F \"elected\"]")};
+    EXPECT_FALSE(storm::generator::NextStateGeneratorOptions(formulas, mdpProgram).hasMaximalExplorationDepth());
+}
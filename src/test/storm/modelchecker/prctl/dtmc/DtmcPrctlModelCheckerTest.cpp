@@ -328,6 +328,24 @@ namespace {
         }
     };
 
+    class SparseParallelTopologicalNativeJacobiEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // unused for sparse models
+        static const DtmcEngine engine = DtmcEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Dtmc<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+            env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().topological().setNumberOfThreads(4);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+
     class HybridSylvanGmmxxGmresEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -574,6 +592,7 @@ namespace {
             SparseNativeIntervalIterationEnvironment,
             SparseNativeRationalSearchEnvironment,
             SparseTopologicalEigenLUEnvironment,
+            SparseParallelTopologicalNativeJacobiEnvironment,
             HybridSylvanGmmxxGmresEnvironment,
             HybridCuddNativeJacobiEnvironment,
             HybridCuddNativeSoundValueIterationEnvironment,
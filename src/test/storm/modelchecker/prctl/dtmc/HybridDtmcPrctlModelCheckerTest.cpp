@@ -0,0 +1,81 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <algorithm>
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/HybridQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+
+TEST(HybridDtmcPrctlModelCheckerTest, ResultMatchesSparseEngine) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> symbolicModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(program);
+    std::shared_ptr<storm::models::sparse::Model<double>> sparseModel = storm::builder::ExplicitModelBuilder<double>(program).build();
+    auto const& symbolicDtmc = *symbolicModel->as<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>>();
+    auto const& sparseDtmc = *sparseModel->as<storm::models::sparse::Dtmc<double>>();
+
+    storm::Environment env;
+    storm::modelchecker::HybridDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>> hybridChecker(symbolicDtmc);
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> sparseChecker(sparseDtmc);
+    std::shared_ptr<storm::logic::Formula const> formula = storm::parser::FormulaParser().parseSingleFormulaFromString("P=? [F \"one\"]");
+    std::unique_ptr<storm::modelchecker::CheckResult> hybridResult = hybridChecker.check(env, *formula);
+    std::unique_ptr<storm::modelchecker::CheckResult> sparseResult = sparseChecker.check(env, *formula);
+
+    // The values of the states with probability 0 or 1 are stored symbolically, the others explicitly in the order of the ODD.
+    auto const& hybridQuantitativeResult = hybridResult->asHybridQuantitativeCheckResult<storm::dd::DdType::CUDD, double>();
+    ASSERT_FALSE(hybridQuantitativeResult.getSymbolicStates().isZero());
+    ASSERT_FALSE(hybridQuantitativeResult.getExplicitStates().isZero());
+    EXPECT_EQ(hybridQuantitativeResult.getExplicitStates().getNonZeroCount(), hybridQuantitativeResult.getExplicitValueVector().size());
+    EXPECT_EQ(hybridQuantitativeResult.getOdd().getTotalOffset(), hybridQuantitativeResult.getExplicitValueVector().size());
+
+    // The state orders of the models differ, so the values are compared as sorted vectors.
+    std::vector<double> hybridValues = hybridQuantitativeResult.toExplicitQuantitativeCheckResult()->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    std::vector<double> sparseValues = sparseResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    ASSERT_EQ(sparseValues.size(), hybridValues.size());
+    EXPECT_EQ(hybridValues, hybridQuantitativeResult.toExplicitQuantitativeCheckResult(symbolicDtmc.getReachableStates().createOdd())->asExplicitQuantitativeCheckResult<double>().getValueVector());
+    std::sort(hybridValues.begin(), hybridValues.end());
+    std::sort(sparseValues.begin(), sparseValues.end());
+    for (uint64_t index = 0; index < sparseValues.size(); ++index) {
+        EXPECT_NEAR(sparseValues[index], hybridValues[index], 1e-6);
+    }
+    EXPECT_NEAR(sparseResult->asQuantitativeCheckResult<double>().getMin(), hybridResult->asQuantitativeCheckResult<double>().getMin(), 1e-6);
+    EXPECT_NEAR(sparseResult->asQuantitativeCheckResult<double>().getMax(), hybridResult->asQuantitativeCheckResult<double>().getMax(), 1e-6);
+
+    // Filtering by the initial state only keeps an explicitly stored value.
+    std::unique_ptr<storm::modelchecker::CheckResult> hybridInitialResult = hybridResult->clone();
+    hybridInitialResult->filter(storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD>(symbolicDtmc.getReachableStates(), symbolicDtmc.getInitialStates()));
+    std::unique_ptr<storm::modelchecker::CheckResult> sparseInitialResult = sparseResult->clone();
+    sparseInitialResult->filter(storm::modelchecker::ExplicitQualitativeCheckResult(sparseDtmc.getInitialStates()));
+    auto const& hybridInitialQuantitativeResult = hybridInitialResult->asHybridQuantitativeCheckResult<storm::dd::DdType::CUDD, double>();
+    EXPECT_TRUE(hybridInitialQuantitativeResult.getSymbolicStates().isZero());
+    ASSERT_EQ(1ul, hybridInitialQuantitativeResult.getExplicitValueVector().size());
+    EXPECT_EQ(1ul, hybridInitialQuantitativeResult.getOdd().getTotalOffset());
+    EXPECT_NEAR(1.0 / 6.0, hybridInitialQuantitativeResult.getExplicitValueVector().front(), 1e-6);
+    EXPECT_NEAR(sparseInitialResult->asQuantitativeCheckResult<double>().getMin(), hybridInitialResult->asQuantitativeCheckResult<double>().getMin(), 1e-6);
+    EXPECT_NEAR(sparseInitialResult->asQuantitativeCheckResult<double>().getMax(), hybridInitialResult->asQuantitativeCheckResult<double>().getMax(), 1e-6);
+
+    // Filtering by the final states only keeps symbolically stored values.
+    std::unique_ptr<storm::modelchecker::CheckResult> hybridDoneResult = hybridResult->clone();
+    hybridDoneResult->filter(storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD>(symbolicDtmc.getReachableStates(), symbolicDtmc.getStates("done")));
+    std::unique_ptr<storm::modelchecker::CheckResult> sparseDoneResult = sparseResult->clone();
+    sparseDoneResult->filter(storm::modelchecker::ExplicitQualitativeCheckResult(sparseDtmc.getStates("done")));
+    auto const& hybridDoneQuantitativeResult = hybridDoneResult->asHybridQuantitativeCheckResult<storm::dd::DdType::CUDD, double>();
+    EXPECT_TRUE(hybridDoneQuantitativeResult.getExplicitStates().isZero());
+    EXPECT_TRUE(hybridDoneQuantitativeResult.getExplicitValueVector().empty());
+    EXPECT_EQ(6ul, hybridDoneQuantitativeResult.getSymbolicStates().getNonZeroCount());
+    EXPECT_NEAR(sparseDoneResult->asQuantitativeCheckResult<double>().getMin(), hybridDoneResult->asQuantitativeCheckResult<double>().getMin(), 1e-6);
+    EXPECT_NEAR(sparseDoneResult->asQuantitativeCheckResult<double>().getMax(), hybridDoneResult->asQuantitativeCheckResult<double>().getMax(), 1e-6);
+}
@@ -40,6 +40,20 @@ namespace {
         }
     };
     
+    class SparseValueTypeValueIterationMultiThreadedEnvironment {
+    public:
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Mdp<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().lra().setNondetLraMethod(storm::solver::LraMethod::ValueIteration);
+            env.solver().lra().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            env.solver().lra().setNumberOfThreads(2);
+            return env;
+        }
+    };
+    
     class SparseValueTypeLinearProgrammingEnvironment {
     public:
         static const bool isExact = false;
@@ -112,6 +126,7 @@ namespace {
   
     typedef ::testing::Types<
             SparseValueTypeValueIterationEnvironment,
+            SparseValueTypeValueIterationMultiThreadedEnvironment,
             SparseValueTypeLinearProgrammingEnvironment,
             SparseSoundEnvironment
 #ifdef STORM_HAVE_Z3_OPTIMIZE
@@ -196,6 +196,39 @@ namespace {
         }
     };
     
+    class SparseDoubleParallelTopologicalValueIterationEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // Unused for sparse models
+        static const MdpEngine engine = MdpEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Mdp<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+            env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().topological().setNumberOfThreads(4);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setRelativeTerminationCriterion(false);
+            return env;
+        }
+    };
+    
+    class SparseDoubleModifiedPolicyIterationEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // Unused for sparse models
+        static const MdpEngine engine = MdpEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Mdp<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ModifiedPolicyIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            return env;
+        }
+    };
+    
     class SparseDoubleTopologicalSoundValueIterationEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // Unused for sparse models
@@ -509,7 +542,9 @@ namespace {
             SparseDoubleSoundValueIterationEnvironment,
             SparseDoubleOptimisticValueIterationEnvironment,
             SparseDoubleTopologicalValueIterationEnvironment,
+            SparseDoubleParallelTopologicalValueIterationEnvironment,
             SparseDoubleTopologicalSoundValueIterationEnvironment,
+            SparseDoubleModifiedPolicyIterationEnvironment,
             SparseRationalPolicyIterationEnvironment,
             SparseRationalViToPiEnvironment,
             SparseRationalRationalSearchEnvironment,
@@ -24,6 +24,32 @@ namespace {
         }
     };
 
+    class DoublePrioritizedViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrioritizedValueIteration(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+
+    class DoubleMixedPrecisionViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setMixedPrecision(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+
     class DoubleSoundViEnvironment {
     public:
         typedef double ValueType;
@@ -50,6 +76,20 @@ namespace {
         }
     };
 
+    class DoublePrioritizedIntervalIterationEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+            env.solver().minMax().setPrioritizedValueIteration(true);
+            env.solver().setForceSoundness(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+    };
+
     class DoubleOptimisticViEnvironment {
     public:
         typedef double ValueType;
@@ -101,6 +141,18 @@ namespace {
             return env;
         }
     };
+    class DoubleModifiedPIEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ModifiedPolicyIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setModifiedPolicyIterationSteps(2);
+            return env;
+        }
+    };
     class RationalPIEnvironment {
     public:
         typedef storm::RationalNumber ValueType;
@@ -136,12 +188,16 @@ namespace {
   
     typedef ::testing::Types<
             DoubleViEnvironment,
+            DoublePrioritizedViEnvironment,
+            DoubleMixedPrecisionViEnvironment,
             DoubleSoundViEnvironment,
             DoubleIntervalIterationEnvironment,
+            DoublePrioritizedIntervalIterationEnvironment,
             DoubleOptimisticViEnvironment,
             DoubleTopologicalViEnvironment,
             DoubleTopologicalCudaViEnvironment,
             DoublePIEnvironment,
+            DoubleModifiedPIEnvironment,
             RationalPIEnvironment,
             RationalRationalSearchEnvironment
     > TestingTypes;
@@ -175,6 +231,52 @@ namespace {
         ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
         EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
     }
+    
+    TEST(MinMaxLinearEquationSolverTest, MixedPrecisionValueIteration) {
+        // Three states with self-loops, so that several iterations in single precision are necessary.
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.9));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.05));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, 0.5));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, 0.8));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, 0.1));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, 0.95));
+        
+        storm::storage::SparseMatrix<double> A;
+        ASSERT_NO_THROW(A = builder.build(4));
+        std::vector<double> b = {0.05, 0.2, 0.1, 0.05};
+        
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setMixedPrecision(true);
+        env.solver().minMax().setSinglePrecisionThreshold(storm::utility::convertNumber<storm::RationalNumber>(1e-4));
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setMaximalNumberOfIterations(100000);
+        
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+        auto solver = factory.create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 2.0);
+        storm::solver::MinMaxLinearEquationSolverRequirements req = solver->getRequirements(env);
+        req.clearBounds();
+        ASSERT_FALSE(req.hasEnabledRequirement());
+        
+        std::vector<double> x(3);
+        ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(x[0], 0.7, 1e-6);
+        EXPECT_NEAR(x[1], 1.0, 1e-6);
+        EXPECT_NEAR(x[2], 1.0, 1e-6);
+        
+        x = std::vector<double>(3);
+        ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(x[0], 1.0, 1e-6);
+        EXPECT_NEAR(x[1], 1.0, 1e-6);
+        EXPECT_NEAR(x[2], 1.0, 1e-6);
+    }
 }
 
 
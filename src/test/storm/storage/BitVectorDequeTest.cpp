@@ -0,0 +1,73 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <deque>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorDeque.h"
+
+namespace {
+    storm::storage::BitVector createBitVector(uint64_t size, uint64_t seed) {
+        storm::storage::BitVector result(size);
+        for (uint64_t bucket = 0; bucket < size / 64; ++bucket) {
+            result.setFromInt(bucket * 64, 64, seed * 0x9E3779B97F4A7C15ull + bucket);
+        }
+        return result;
+    }
+}
+
+TEST(BitVectorDequeTest, PushAndPop) {
+    storm::storage::BitVectorDeque<uint64_t> deque(128, 2);
+    EXPECT_TRUE(deque.empty());
+
+    deque.pushBack(createBitVector(128, 1), 1);
+    deque.pushBack(createBitVector(128, 2), 2);
+    deque.pushFront(createBitVector(128, 0), 0);
+    EXPECT_EQ(3ul, deque.size());
+
+    storm::storage::BitVector front;
+    for (uint64_t value = 0; value < 3; ++value) {
+        ASSERT_FALSE(deque.empty());
+        deque.getFront(front);
+        EXPECT_EQ(createBitVector(128, value), front);
+        EXPECT_EQ(value, deque.getFrontValue());
+        deque.popFront();
+    }
+    EXPECT_TRUE(deque.empty());
+}
+
+TEST(BitVectorDequeTest, Growth) {
+    // Compare against a std::deque while mixing insertions at both ends with removals, such that the circular buffer
+    // wraps around and has to grow several times.
+    storm::storage::BitVectorDeque<uint32_t> deque(192, 4);
+    std::deque<std::pair<storm::storage::BitVector, uint32_t>> reference;
+
+    storm::storage::BitVector front(192);
+    for (uint32_t value = 0; value < 1000; ++value) {
+        storm::storage::BitVector bitVector = createBitVector(192, value);
+        if (value % 3 == 0) {
+            deque.pushFront(bitVector, value);
+            reference.emplace_front(bitVector, value);
+        } else {
+            deque.pushBack(bitVector, value);
+            reference.emplace_back(bitVector, value);
+        }
+        if (value % 5 == 0) {
+            deque.getFront(front);
+            EXPECT_EQ(reference.front().first, front);
+            EXPECT_EQ(reference.front().second, deque.getFrontValue());
+            deque.popFront();
+            reference.pop_front();
+        }
+    }
+
+    ASSERT_EQ(reference.size(), deque.size());
+    while (!reference.empty()) {
+        deque.getFront(front);
+        EXPECT_EQ(reference.front().first, front);
+        EXPECT_EQ(reference.front().second, deque.getFrontValue());
+        deque.popFront();
+        reference.pop_front();
+    }
+    EXPECT_TRUE(deque.empty());
+}
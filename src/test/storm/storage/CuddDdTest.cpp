@@ -432,6 +432,24 @@ TEST(CuddDd, IdentityTest) {
     EXPECT_EQ(21ul, identity.getNodeCount());
 }
 
+TEST(CuddDd, MemoryStatisticsTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    
+    storm::dd::Add<storm::dd::DdType::CUDD, double> identity;
+    ASSERT_NO_THROW(identity = manager->getIdentity<double>(x.first));
+    
+    EXPECT_LT(0ul, manager->getNumberOfNodes());
+    EXPECT_LT(0ul, manager->getMemoryInUse());
+    EXPECT_LE(0.0, manager->getCacheHitRate());
+    EXPECT_GE(1.0, manager->getCacheHitRate());
+    
+    ASSERT_NO_THROW(manager->performGarbageCollection());
+    EXPECT_LT(0ul, manager->getNumberOfNodes());
+    EXPECT_FALSE(manager->isMemoryBudgetExceeded());
+    EXPECT_NO_THROW(manager->checkMemoryBudget());
+}
+
 TEST(CuddDd, OperatorTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -176,3 +176,40 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, RemovedConnectingChoice) {
+    // State 0 can only move to state 1, which either stays in state 1 or moves to states 0 and 2 with equal probability.
+    // The choice of state 1 that reaches state 0 also leaves the SCC {0, 1}, so state 0 is not part of an MEC.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 3, 5, true, true, 3);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 1, 1.0);
+    matrixBuilder.newRowGroup(1);
+    matrixBuilder.addNextValue(1, 0, 0.5);
+    matrixBuilder.addNextValue(1, 2, 0.5);
+    matrixBuilder.addNextValue(2, 1, 1.0);
+    matrixBuilder.newRowGroup(3);
+    matrixBuilder.addNextValue(3, 2, 1.0);
+    storm::storage::SparseMatrix<double> transitionMatrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = transitionMatrix.transpose(true);
+    
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(transitionMatrix, backwardTransitions);
+    ASSERT_EQ(2ull, mecDecomposition.size());
+    EXPECT_TRUE(mecDecomposition[0].getStateSet() == storm::storage::MaximalEndComponent::set_type{2});
+    EXPECT_TRUE(mecDecomposition[0].getChoicesForState(2) == storm::storage::MaximalEndComponent::set_type{3});
+    ASSERT_TRUE(mecDecomposition[1].getStateSet() == storm::storage::MaximalEndComponent::set_type{1});
+    EXPECT_TRUE(mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{2});
+    
+    // The same holds if the subsystem consists of states 0 and 1 only.
+    storm::storage::BitVector subsystem(3, {0, 1});
+    mecDecomposition = storm::storage::MaximalEndComponentDecomposition<double>(transitionMatrix, backwardTransitions, subsystem);
+    ASSERT_EQ(1ull, mecDecomposition.size());
+    ASSERT_TRUE(mecDecomposition[0].getStateSet() == storm::storage::MaximalEndComponent::set_type{1});
+    EXPECT_TRUE(mecDecomposition[0].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{2});
+    
+    // Refining the candidates in parallel yields the same MECs.
+    mecDecomposition = storm::storage::MaximalEndComponentDecomposition<double>(transitionMatrix, backwardTransitions, true);
+    ASSERT_EQ(2ull, mecDecomposition.size());
+    EXPECT_TRUE(mecDecomposition[0].getStateSet() == storm::storage::MaximalEndComponent::set_type{2});
+    ASSERT_TRUE(mecDecomposition[1].getStateSet() == storm::storage::MaximalEndComponent::set_type{1});
+    EXPECT_TRUE(mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{2});
+}
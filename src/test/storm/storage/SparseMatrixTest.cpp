@@ -95,6 +95,46 @@ TEST(SparseMatrixBuilder, AddNextValue) {
     ASSERT_NO_THROW(matrixBuilder4.addNextValue(3, 1, 0.2));
 }
 
+TEST(SparseMatrixBuilder, ManyEntries) {
+    // Without the number of entries, the entries are stored in several chunks. Rows that are inserted unordered,
+    // rows crossing the end of a chunk and rows larger than a chunk must yield the same matrix as a preallocated builder.
+    uint64_t const rowCount = 3000;
+    uint64_t const longRow = 1500;
+    uint64_t const longRowLength = 5000;
+    uint64_t const entryCount = (rowCount - 1) * 3 + longRowLength;
+    storm::storage::SparseMatrixBuilder<double> chunkedBuilder(0, 0, 0, false, true);
+    storm::storage::SparseMatrixBuilder<double> preallocatedBuilder(rowCount, longRowLength, entryCount, true, true, rowCount);
+    for (auto builder : {&chunkedBuilder, &preallocatedBuilder}) {
+        for (uint64_t row = 0; row < rowCount; ++row) {
+            builder->newRowGroup(row);
+            if (row == longRow) {
+                for (uint64_t column = 0; column < longRowLength; ++column) {
+                    builder->addNextValue(row, column, 1.0);
+                }
+            } else {
+                builder->addNextValue(row, (row + 2) % rowCount, 0.2);
+                builder->addNextValue(row, (row + 1) % rowCount, 0.3);
+                builder->addNextValue(row, row, 0.5);
+            }
+        }
+    }
+    
+    std::vector<uint_fast64_t> reversal(longRowLength);
+    for (uint64_t column = 0; column < longRowLength; ++column) {
+        reversal[column] = longRowLength - column - 1;
+    }
+    chunkedBuilder.replaceColumns(reversal, 0);
+    preallocatedBuilder.replaceColumns(reversal, 0);
+    
+    storm::storage::SparseMatrix<double> chunkedMatrix = chunkedBuilder.build();
+    storm::storage::SparseMatrix<double> preallocatedMatrix = preallocatedBuilder.build();
+    EXPECT_EQ(entryCount, chunkedMatrix.getEntryCount());
+    EXPECT_EQ(rowCount, chunkedMatrix.getRowGroupCount());
+    EXPECT_TRUE(chunkedMatrix == preallocatedMatrix);
+    EXPECT_EQ(0.5, chunkedMatrix.getRow(0).begin()[2].getValue());
+    EXPECT_EQ(longRowLength - 1, chunkedMatrix.getRow(0).begin()[2].getColumn());
+}
+
 TEST(SparseMatrix, Build) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder1(3, 4, 5);
     ASSERT_NO_THROW(matrixBuilder1.addNextValue(0, 1, 1.0));
@@ -450,6 +490,102 @@ TEST(SparseMatrix, Submatrix) {
     ASSERT_TRUE(matrix4 == matrix5);
 }
 
+TEST(SparseMatrix, BlockSubmatrix) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9, true, true);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 1.1));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 0, 0.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 1, 0.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 3, 0.3));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    // The columns are partitioned into the blocks {0, 2} and {1, 3}.
+    std::vector<uint_fast64_t> blockOfColumn = {0, 1, 0, 1};
+    std::vector<uint_fast64_t> indexInBlock = {0, 0, 1, 1};
+    std::vector<std::vector<uint_fast64_t>> blocks = {{0, 2}, {1, 3}};
+    
+    // The same matrix is overwritten with the submatrices of all blocks.
+    storm::storage::SparseMatrix<double> submatrix;
+    for (uint_fast64_t block = 0; block < blocks.size(); ++block) {
+        storm::storage::BitVector constraint(4);
+        for (auto const& column : blocks[block]) {
+            constraint.set(column);
+        }
+        for (bool insertDiagonalEntries : {false, true}) {
+            ASSERT_NO_THROW(submatrix.setToBlockSubmatrix(matrix, blocks[block], blockOfColumn, block, indexInBlock, insertDiagonalEntries));
+            storm::storage::SparseMatrix<double> expectedSubmatrix = matrix.getSubmatrix(true, constraint, constraint, insertDiagonalEntries);
+            EXPECT_TRUE(submatrix == expectedSubmatrix) << "Block " << block << ", insertDiagonalEntries=" << insertDiagonalEntries;
+            EXPECT_EQ(expectedSubmatrix.getEntryCount(), submatrix.getEntryCount());
+            EXPECT_EQ(2ul, submatrix.getColumnCount());
+            EXPECT_EQ(2ul, submatrix.getRowGroupCount());
+        }
+    }
+    
+    // For a matrix with trivial row grouping, the submatrix has a trivial row grouping as well.
+    storm::storage::SparseMatrix<double> matrix2 = matrix.selectRowsFromRowGroups({0, 0, 1, 0});
+    std::vector<uint_fast64_t> rowGroups = {1, 3};
+    ASSERT_NO_THROW(submatrix.setToBlockSubmatrix(matrix2, rowGroups, blockOfColumn, 1, indexInBlock, true));
+    EXPECT_TRUE(submatrix.hasTrivialRowGrouping());
+    storm::storage::BitVector constraint(4);
+    constraint.set(1);
+    constraint.set(3);
+    EXPECT_TRUE(submatrix == matrix2.getSubmatrix(false, constraint, constraint, true));
+}
+
+TEST(SparseMatrix, UpdateRowsFromRowGroups) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(7, 3, 11, true, true, 3);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 1, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 0, 0.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 1, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 2, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(5, 0, 0.4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(6, 0, 0.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(6, 1, 0.9));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    // Rows are replaced by shorter rows, longer rows, and rows of the same length.
+    std::vector<std::vector<uint_fast64_t>> schedulers = {{0, 0, 0}, {1, 1, 0}, {1, 1, 2}, {0, 0, 1}, {0, 1, 1}};
+    std::vector<std::vector<uint_fast64_t>> changedRowGroups = {{}, {0, 1}, {2}, {0, 1, 2}, {1}};
+    for (bool insertDiagonalEntries : {false, true}) {
+        for (bool convertToEquationSystem : {false, true}) {
+            if (convertToEquationSystem && !insertDiagonalEntries) {
+                continue;
+            }
+            storm::storage::SparseMatrix<double> inducedMatrix = matrix.selectRowsFromRowGroups(schedulers.front(), insertDiagonalEntries);
+            if (convertToEquationSystem) {
+                inducedMatrix.convertToEquationSystem();
+            }
+            for (uint_fast64_t index = 1; index < schedulers.size(); ++index) {
+                ASSERT_NO_THROW(inducedMatrix.updateRowsFromRowGroups(matrix, schedulers[index], changedRowGroups[index], insertDiagonalEntries, convertToEquationSystem));
+                storm::storage::SparseMatrix<double> expectedMatrix = matrix.selectRowsFromRowGroups(schedulers[index], insertDiagonalEntries);
+                if (convertToEquationSystem) {
+                    expectedMatrix.convertToEquationSystem();
+                }
+                EXPECT_TRUE(inducedMatrix == expectedMatrix) << "Scheduler " << index << ", insertDiagonalEntries=" << insertDiagonalEntries << ", convertToEquationSystem=" << convertToEquationSystem;
+                EXPECT_EQ(expectedMatrix.getEntryCount(), inducedMatrix.getEntryCount());
+                EXPECT_EQ(expectedMatrix.getNonzeroEntryCount(), inducedMatrix.getNonzeroEntryCount());
+            }
+        }
+    }
+}
+
 TEST(SparseMatrix, RestrictRows) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder1(7, 4, 9, true, true, 3);
     ASSERT_NO_THROW(matrixBuilder1.newRowGroup(0));
@@ -0,0 +1,87 @@
+#include "test/storm_gtest.h"
+
+#include <boost/filesystem.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SpilledBitVectorMap.h"
+#include "storm/storage/sparse/StateStorage.h"
+
+namespace {
+    // Creates a key that stores the given value in its first 32 bits and its complement in its last 32 bits.
+    storm::storage::BitVector createKey(uint64_t size, uint32_t value) {
+        storm::storage::BitVector result(size);
+        result.setFromInt(0, 32, value);
+        result.setFromInt(size - 32, 32, ~value);
+        return result;
+    }
+
+    std::string getSpillDirectory() {
+        return (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-spill-test-%%%%-%%%%")).string();
+    }
+}
+
+TEST(SpilledBitVectorMapTest, SpillAndFind) {
+    std::string directory = getSpillDirectory();
+    {
+        storm::storage::SpilledBitVectorMap<uint32_t> spilledMap(128, directory, 16);
+        for (uint32_t segment = 0; segment < 3; ++segment) {
+            storm::storage::BitVectorHashMap<uint32_t> map(128, 100);
+            for (uint32_t value = segment * 1000; value < (segment + 1) * 1000; ++value) {
+                map.findOrAdd(createKey(128, value), value);
+            }
+            spilledMap.spill(map);
+        }
+        ASSERT_EQ(3000ul, spilledMap.size());
+
+        for (uint32_t value = 0; value < 3000; ++value) {
+            auto result = spilledMap.find(createKey(128, value));
+            ASSERT_TRUE(static_cast<bool>(result));
+            EXPECT_EQ(value, result.get());
+        }
+        for (uint32_t value = 3000; value < 4000; ++value) {
+            EXPECT_FALSE(static_cast<bool>(spilledMap.find(createKey(128, value))));
+        }
+
+        spilledMap.remap([] (uint32_t const& value) { return 2 * value; });
+        uint64_t numberOfEntries = 0;
+        spilledMap.forEach([&] (storm::storage::BitVector const& key, uint32_t const& value) {
+            EXPECT_EQ(0u, value % 2);
+            EXPECT_EQ(createKey(128, value / 2), key);
+            ++numberOfEntries;
+        });
+        EXPECT_EQ(3000ul, numberOfEntries);
+        EXPECT_EQ(84u, spilledMap.find(createKey(128, 42)).get());
+    }
+    EXPECT_TRUE(boost::filesystem::is_empty(directory));
+    boost::filesystem::remove_all(directory);
+}
+
+TEST(SpilledBitVectorMapTest, StateStorage) {
+    std::string directory = getSpillDirectory();
+    {
+        storm::storage::sparse::StateStorage<uint32_t> stateStorage(64);
+        stateStorage.enableSpilling(directory, 100);
+        for (uint32_t state = 0; state < 1000; ++state) {
+            EXPECT_EQ(state, stateStorage.findOrAdd(createKey(64, state), static_cast<uint32_t>(stateStorage.getNumberOfStates())));
+        }
+        EXPECT_TRUE(stateStorage.hasSpilledStates());
+        EXPECT_EQ(1000ul, stateStorage.getNumberOfStates());
+
+        // Revisiting states must yield their original indices, no matter whether they are held in memory or not.
+        for (uint32_t state = 0; state < 1000; state += 7) {
+            EXPECT_EQ(state, stateStorage.findOrAdd(createKey(64, state), 1000));
+        }
+        EXPECT_EQ(1000ul, stateStorage.getNumberOfStates());
+        EXPECT_EQ(500u, stateStorage.getStateIndex(createKey(64, 500)).get());
+        EXPECT_FALSE(static_cast<bool>(stateStorage.getStateIndex(createKey(64, 1000))));
+
+        storm::storage::BitVector seen(1000);
+        stateStorage.forEachState([&] (storm::storage::BitVector const& state, uint32_t const& index) {
+            EXPECT_EQ(createKey(64, index), state);
+            seen.set(index);
+        });
+        EXPECT_TRUE(seen.full());
+    }
+    boost::filesystem::remove_all(directory);
+}
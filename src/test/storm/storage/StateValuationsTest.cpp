@@ -0,0 +1,103 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/constants.h"
+
+TEST(StateValuationsTest, BuildAndAccess) {
+    storm::expressions::ExpressionManager manager;
+    storm::expressions::Variable b = manager.declareBooleanVariable("b");
+    storm::expressions::Variable x = manager.declareIntegerVariable("x");
+    storm::expressions::Variable y = manager.declareIntegerVariable("y");
+    storm::expressions::Variable r = manager.declareRationalVariable("r");
+
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.addVariable(b);
+    builder.addVariable(x, 0, 10);
+    builder.addVariable(y);
+    builder.addVariable(r);
+
+    uint64_t const numberOfStates = 1000;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        int64_t stateAsInt = static_cast<int64_t>(state);
+        builder.addState(state, {state % 3 == 0}, {stateAsInt % 11, 500 - stateAsInt * stateAsInt}, {storm::utility::convertNumber<storm::RationalNumber>(stateAsInt) / storm::utility::convertNumber<storm::RationalNumber>(2)});
+    }
+    storm::storage::sparse::StateValuations valuations = builder.build(numberOfStates);
+
+    ASSERT_EQ(numberOfStates, valuations.getNumberOfStates());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        int64_t stateAsInt = static_cast<int64_t>(state);
+        EXPECT_FALSE(valuations.isEmpty(state));
+        EXPECT_EQ(state % 3 == 0, valuations.getBooleanValue(state, b));
+        EXPECT_EQ(stateAsInt % 11, valuations.getIntegerValue(state, x));
+        EXPECT_EQ(500 - stateAsInt * stateAsInt, valuations.getIntegerValue(state, y));
+        EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(stateAsInt) / storm::utility::convertNumber<storm::RationalNumber>(2), valuations.getRationalValue(state, r));
+    }
+
+    EXPECT_EQ("[b\t& x=0\t& y=500\t& r=0]", valuations.toString(0));
+    EXPECT_EQ("[false\t2\t496]", valuations.toString(2, false, std::set<storm::expressions::Variable>({b, x, y})));
+}
+
+TEST(StateValuationsTest, SelectAndBlowup) {
+    storm::expressions::ExpressionManager manager;
+    storm::expressions::Variable b = manager.declareBooleanVariable("b");
+    storm::expressions::Variable x = manager.declareIntegerVariable("x");
+
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.addVariable(b);
+    builder.addVariable(x);
+    for (uint64_t state = 0; state < 10; ++state) {
+        builder.addState(state, {state % 2 == 0}, {-static_cast<int64_t>(state)});
+    }
+    storm::storage::sparse::StateValuations valuations = builder.build(10);
+
+    storm::storage::BitVector selectedStates(10);
+    selectedStates.set(3);
+    selectedStates.set(8);
+    storm::storage::sparse::StateValuations selected = valuations.selectStates(selectedStates);
+    ASSERT_EQ(2ull, selected.getNumberOfStates());
+    EXPECT_FALSE(selected.getBooleanValue(0, b));
+    EXPECT_EQ(-3, selected.getIntegerValue(0, x));
+    EXPECT_TRUE(selected.getBooleanValue(1, b));
+    EXPECT_EQ(-8, selected.getIntegerValue(1, x));
+
+    selected = valuations.selectStates(std::vector<storm::storage::sparse::state_type>({9, 42, 1}));
+    ASSERT_EQ(3ull, selected.getNumberOfStates());
+    EXPECT_EQ(-9, selected.getIntegerValue(0, x));
+    EXPECT_TRUE(selected.isEmpty(1));
+    EXPECT_EQ(-1, selected.getIntegerValue(2, x));
+
+    storm::storage::sparse::StateValuations blownUp = valuations.blowup({0, 0, 5});
+    ASSERT_EQ(3ull, blownUp.getNumberOfStates());
+    EXPECT_EQ(0, blownUp.getIntegerValue(1, x));
+    EXPECT_EQ(-5, blownUp.getIntegerValue(2, x));
+    EXPECT_FALSE(blownUp.getBooleanValue(2, b));
+}
+
+TEST(StateValuationsTest, Json) {
+    storm::expressions::ExpressionManager manager;
+    storm::expressions::Variable b = manager.declareBooleanVariable("b");
+    storm::expressions::Variable x = manager.declareIntegerVariable("x");
+
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.addVariable(b);
+    builder.addVariable(x, -2, 2);
+    for (uint64_t state = 0; state < 5; ++state) {
+        builder.addState(state, {state == 4}, {static_cast<int64_t>(state) - 2});
+    }
+    storm::storage::sparse::StateValuations valuations = builder.build(5);
+
+    storm::storage::BitVector allStates(5, true);
+    auto json = valuations.toJson(allStates);
+    ASSERT_EQ(5ull, json.size());
+    for (uint64_t state = 0; state < 5; ++state) {
+        EXPECT_EQ(valuations.toJson(state), json[state]);
+    }
+    EXPECT_EQ(2, json[4]["x"].get<int64_t>());
+    EXPECT_TRUE(json[4]["b"].get<bool>());
+
+    auto xOnly = valuations.toJson(allStates, std::set<storm::expressions::Variable>({x}));
+    EXPECT_EQ(1ull, xOnly[0].size());
+    EXPECT_EQ(-2, xOnly[0]["x"].get<int64_t>());
+}
@@ -575,6 +575,24 @@ TEST(SylvanDd, UintIdentityTest) {
     EXPECT_EQ(21ul, identity.getNodeCount());
 }
 
+TEST(SylvanDd, MemoryStatisticsTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> identity;
+    ASSERT_NO_THROW(identity = manager->getIdentity<double>(x.first));
+    
+    EXPECT_LT(0ul, manager->getNumberOfNodes());
+    EXPECT_LT(0ul, manager->getMemoryInUse());
+    EXPECT_LE(0.0, manager->getCacheHitRate());
+    EXPECT_GE(1.0, manager->getCacheHitRate());
+    
+    ASSERT_NO_THROW(manager->performGarbageCollection());
+    EXPECT_LT(0ul, manager->getNumberOfNodes());
+    EXPECT_FALSE(manager->isMemoryBudgetExceeded());
+    EXPECT_NO_THROW(manager->checkMemoryBudget());
+}
+
 TEST(SylvanDd, OperatorTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
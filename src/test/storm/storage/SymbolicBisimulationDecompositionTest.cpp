@@ -7,6 +7,8 @@
 #include "storm/builder/DdPrismModelBuilder.h"
 
 #include "storm/storage/dd/BisimulationDecomposition.h"
+#include "storm/storage/dd/bisimulation/NondeterministicModelPartitionRefiner.h"
+#include "storm/storage/dd/bisimulation/PreservationInformation.h"
 #include "storm/storage/SymbolicModelDescription.h"
 
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
@@ -467,3 +469,61 @@ TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeader_Sylvan) {
     EXPECT_TRUE(quotient->isSymbolicModel());
     EXPECT_EQ(2152ul, (quotient->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan, double>>()->getNumberOfChoices()));
 }
+
+namespace {
+    // Relates all states (over the row variables) to the states in the same block (over the column variables), which
+    // makes partitions comparable independently of the block numbers.
+    template<storm::dd::DdType DdType>
+    storm::dd::Bdd<DdType> getStateEquivalence(storm::models::symbolic::Model<DdType, double> const& model, storm::dd::bisimulation::Partition<DdType, double> const& statePartition) {
+        storm::dd::Bdd<DdType> partitionBdd = statePartition.storedAsBdd() ? statePartition.asBdd() : statePartition.asAdd().notZero();
+        return partitionBdd.swapVariables(model.getRowColumnMetaVariablePairs()).andExists(partitionBdd, {statePartition.getBlockVariable()});
+    }
+}
+
+TEST(SymbolicModelBisimulationDecomposition, DirtyBlockRefinement_Cudd) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(program);
+    storm::dd::bisimulation::PreservationInformation<storm::dd::DdType::CUDD, double> preservationInformation(*model);
+    auto initialPartition = storm::dd::bisimulation::Partition<storm::dd::DdType::CUDD, double>::create(*model, storm::storage::BisimulationType::Strong, preservationInformation);
+    
+    storm::dd::bisimulation::PartitionRefiner<storm::dd::DdType::CUDD, double> fullRefiner(*model, initialPartition);
+    fullRefiner.setRestrictToDirtyBlocks(*model, false);
+    while (fullRefiner.refine()) {}
+    EXPECT_EQ(11ul, fullRefiner.getStatePartition().getNumberOfBlocks());
+    
+    // With lazy signatures, refinement steps may be decided by the qualitative signature only.
+    for (auto mode : {storm::dd::bisimulation::SignatureMode::Eager, storm::dd::bisimulation::SignatureMode::Lazy}) {
+        storm::dd::bisimulation::PartitionRefiner<storm::dd::DdType::CUDD, double> dirtyRefiner(*model, initialPartition);
+        dirtyRefiner.setRestrictToDirtyBlocks(*model, true);
+        while (dirtyRefiner.refine(mode)) {}
+        
+        EXPECT_EQ(fullRefiner.getStatePartition().getNumberOfBlocks(), dirtyRefiner.getStatePartition().getNumberOfBlocks());
+        EXPECT_TRUE(getStateEquivalence(*model, fullRefiner.getStatePartition()) == getStateEquivalence(*model, dirtyRefiner.getStatePartition()));
+    }
+}
+
+TEST(SymbolicModelBisimulationDecomposition, DirtyBlockRefinement_Sylvan) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(program);
+    auto const& mdp = *model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan, double>>();
+    storm::dd::bisimulation::PreservationInformation<storm::dd::DdType::Sylvan, double> preservationInformation(*model);
+    auto initialPartition = storm::dd::bisimulation::Partition<storm::dd::DdType::Sylvan, double>::create(*model, storm::storage::BisimulationType::Strong, preservationInformation);
+    
+    storm::dd::bisimulation::NondeterministicModelPartitionRefiner<storm::dd::DdType::Sylvan, double> fullRefiner(mdp, initialPartition);
+    fullRefiner.setRestrictToDirtyBlocks(mdp, false);
+    while (fullRefiner.refine()) {}
+    EXPECT_EQ(77ul, fullRefiner.getStatePartition().getNumberOfBlocks());
+    
+    // With lazy signatures, refinement steps may be decided by the qualitative signature only.
+    for (auto mode : {storm::dd::bisimulation::SignatureMode::Eager, storm::dd::bisimulation::SignatureMode::Lazy}) {
+        storm::dd::bisimulation::NondeterministicModelPartitionRefiner<storm::dd::DdType::Sylvan, double> dirtyRefiner(mdp, initialPartition);
+        dirtyRefiner.setRestrictToDirtyBlocks(mdp, true);
+        while (dirtyRefiner.refine(mode)) {}
+        
+        EXPECT_EQ(fullRefiner.getStatePartition().getNumberOfBlocks(), dirtyRefiner.getStatePartition().getNumberOfBlocks());
+        EXPECT_EQ(fullRefiner.getChoicePartition().getNumberOfBlocks(), dirtyRefiner.getChoicePartition().getNumberOfBlocks());
+        EXPECT_TRUE(getStateEquivalence(*model, fullRefiner.getStatePartition()) == getStateEquivalence(*model, dirtyRefiner.getStatePartition()));
+    }
+}
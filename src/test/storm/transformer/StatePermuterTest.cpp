@@ -0,0 +1,59 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/utility/permutation.h"
+
+namespace {
+    void checkPermutedModels(std::string const& filename, std::string const& formulasString) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(filename, true);
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel<double>(program, formulas);
+        uint64_t initialState = model->getInitialStates().getNextSetIndex(0);
+
+        for (auto const& order : storm::utility::permutation::getOrderKinds()) {
+            std::vector<uint64_t> stateOrder = storm::utility::permutation::createStateOrder(order, model->getTransitionMatrix(), model->getInitialStates());
+            ASSERT_EQ(model->getNumberOfStates(), stateOrder.size());
+            std::vector<uint64_t> newStateIndices = storm::utility::permutation::invertPermutation(stateOrder);
+            for (uint64_t state = 0; state < stateOrder.size(); ++state) {
+                ASSERT_EQ(state, stateOrder[newStateIndices[state]]);
+            }
+
+            std::shared_ptr<storm::models::sparse::Model<double>> permutedModel = storm::api::permuteModelStates(model, order);
+            EXPECT_EQ(model->getType(), permutedModel->getType());
+            EXPECT_EQ(model->getNumberOfStates(), permutedModel->getNumberOfStates());
+            EXPECT_EQ(model->getNumberOfChoices(), permutedModel->getNumberOfChoices());
+            EXPECT_EQ(model->getNumberOfTransitions(), permutedModel->getNumberOfTransitions());
+            for (auto const& label : model->getStateLabeling().getLabels()) {
+                EXPECT_EQ(model->getStates(label), permutedModel->getStates(label).permute(newStateIndices)) << "Label " << label << " in " << storm::utility::permutation::orderKindToString(order) << " order.";
+            }
+
+            uint64_t permutedInitialState = newStateIndices[initialState];
+            EXPECT_TRUE(permutedModel->getInitialStates().get(permutedInitialState));
+            for (auto const& formula : formulas) {
+                auto result = storm::api::verifyWithSparseEngine(model, storm::api::createTask<double>(formula, true));
+                auto permutedResult = storm::api::verifyWithSparseEngine(permutedModel, storm::api::createTask<double>(formula, true));
+                EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[initialState], permutedResult->asExplicitQuantitativeCheckResult<double>()[permutedInitialState], 1e-6) << *formula << " in " << storm::utility::permutation::orderKindToString(order) << " order.";
+            }
+        }
+    }
+}
+
+TEST(StatePermuterTest, Dtmc) {
+    checkPermutedModels(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", "P=? [F \"one\"];R{\"coin_flips\"}=? [F \"done\"]");
+}
+
+TEST(StatePermuterTest, Mdp) {
+    checkPermutedModels(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", "Pmin=? [F \"finished\" & \"all_coins_equal_1\"];Rmax{\"steps\"}=? [F \"finished\"]");
+}
+
+TEST(StatePermuterTest, Ctmc) {
+    checkPermutedModels(STORM_TEST_RESOURCES_DIR "/ctmc/embedded2.sm", "P=? [F<=10000 \"down\"];R{\"up\"}=? [C<=10000]");
+}
+
+TEST(StatePermuterTest, MarkovAutomaton) {
+    checkPermutedModels(STORM_TEST_RESOURCES_DIR "/ma/stream2.ma", "Pmin=? [F \"done\"];Tmin=? [F \"done\"]");
+}